@@ -178,6 +178,95 @@ TEST_CASE("Basis-singular", "[highs_basis_data]") {
   REQUIRE(highs.setBasis(basis) == HighsStatus::kOk);
 }
 
+TEST_CASE("Basis-same-basic-variables", "[highs_basis_data]") {
+  // Setting a basis with the basic variables of the current simplex
+  // basis keeps its factorization, so re-solving from the optimal
+  // basis requires no iterations, and moving a nonbasic variable to
+  // its other bound is corrected by the simplex solver. The hot start
+  // data are set up whenever the basis matrix is factorized, and remain
+  // valid when a basis with the same basic variables is set
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/avgas.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(model_file);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double optimal_objective = highs.getInfo().objective_function_value;
+  HighsBasis basis = highs.getBasis();
+
+  REQUIRE(highs.getHotStart().valid);
+  int64_t num_invert = highs.getSimplexNumInvert();
+  REQUIRE(num_invert > 0);
+  REQUIRE(highs.setBasis(basis) == HighsStatus::kOk);
+  REQUIRE(highs.getHotStart().valid);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(highs.getInfo().simplex_iteration_count == 0);
+  REQUIRE(highs.getSimplexNumInvert() == num_invert);
+  REQUIRE(highs.getHotStart().valid);
+
+  // fixing a nonbasic variable at its bound doesn't change the basic
+  // variables, so the factorization is still reused
+  const HighsLp& lp = highs.getLp();
+  HighsInt fix_col = -1;
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+    if (basis.col_status[iCol] == HighsBasisStatus::kLower) {
+      fix_col = iCol;
+      break;
+    }
+  }
+  REQUIRE(fix_col >= 0);
+  const double fix_col_upper = lp.col_upper_[fix_col];
+  highs.changeColBounds(fix_col, lp.col_lower_[fix_col],
+                        lp.col_lower_[fix_col]);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  num_invert = highs.getSimplexNumInvert();
+  REQUIRE(highs.setBasis(highs.getBasis()) == HighsStatus::kOk);
+  REQUIRE(highs.getHotStart().valid);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(highs.getInfo().simplex_iteration_count == 0);
+  REQUIRE(highs.getSimplexNumInvert() == num_invert);
+  REQUIRE(highs.getHotStart().valid);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) <=
+          1e-8 * std::max(1.0, std::fabs(optimal_objective)));
+  highs.changeColBounds(fix_col, lp.col_lower_[fix_col], fix_col_upper);
+
+  HighsInt move_col = -1;
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+    if (basis.col_status[iCol] == HighsBasisStatus::kLower &&
+        lp.col_upper_[iCol] < kHighsInf &&
+        lp.col_lower_[iCol] < lp.col_upper_[iCol]) {
+      move_col = iCol;
+      break;
+    }
+  }
+  REQUIRE(move_col >= 0);
+  basis.col_status[move_col] = HighsBasisStatus::kUpper;
+  REQUIRE(highs.setBasis(basis) == HighsStatus::kOk);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                    optimal_objective) <=
+          1e-8 * std::max(1.0, std::fabs(optimal_objective)));
+
+  // a basis with different basic variables is factorized, and its hot
+  // start data are set up again
+  HighsBasis logical_basis;
+  logical_basis.col_status.assign(lp.num_col_, HighsBasisStatus::kLower);
+  logical_basis.row_status.assign(lp.num_row_, HighsBasisStatus::kBasic);
+  num_invert = highs.getSimplexNumInvert();
+  REQUIRE(highs.setBasis(logical_basis) == HighsStatus::kOk);
+  REQUIRE(!highs.getHotStart().valid);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(highs.getSimplexNumInvert() > num_invert);
+  REQUIRE(highs.getHotStart().valid);
+}
+
 // No commas in test case name.
 void testBasisReloadModel(Highs& highs, const bool from_file) {
   // Checks that no simplex iterations are required if a saved optimal
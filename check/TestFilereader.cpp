@@ -1,4 +1,7 @@
+#include <algorithm>
 #include <cstdio>
+#include <fstream>
+#include <sstream>
 
 #include "HCheckConfig.h"
 #include "Highs.h"
@@ -343,3 +346,217 @@ TEST_CASE("filereader-dD2e", "[highs_filereader]") {
   objective_value = highs.getInfo().objective_function_value;
   REQUIRE(objective_value == optimal_objective_value);
 }
+
+TEST_CASE("filereader-hbm", "[highs_filereader]") {
+  // Write the model, basis and solution of a QP and a MIP to .hbm
+  // files, and check that they are read back exactly. The files have
+  // the same name as the models, since the model name is taken from the
+  // file name
+  const std::vector<std::string> models = {"primal1", "egout"};
+  for (const std::string& model : models) {
+    Highs highs;
+    highs.setOptionValue("output_flag", dev_run);
+    REQUIRE(highs.readModel(std::string(HIGHS_DIR) + "/check/instances/" +
+                            model + ".mps") == HighsStatus::kOk);
+    std::vector<std::string> filenames = {model + ".hbm"};
+#ifdef ZLIB_FOUND
+    filenames.push_back(model + ".hbm.gz");
+#endif
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    const bool is_mip = highs.getLp().isMip();
+    for (const std::string& filename : filenames) {
+      REQUIRE(highs.writeModel(filename) == HighsStatus::kOk);
+
+      Highs highs_hbm;
+      highs_hbm.setOptionValue("output_flag", dev_run);
+      REQUIRE(highs_hbm.readModel(filename) == HighsStatus::kOk);
+      REQUIRE(highs_hbm.getLp().equalButForNames(highs.getLp()));
+      if (highs.getModel().hessian_.dim_)
+        REQUIRE(highs_hbm.getModel().hessian_ == highs.getModel().hessian_);
+      REQUIRE(highs_hbm.getLp().col_names_ == highs.getLp().col_names_);
+      REQUIRE(highs_hbm.getLp().row_names_ == highs.getLp().row_names_);
+      REQUIRE(highs_hbm.getSolution().col_value ==
+              highs.getSolution().col_value);
+      if (!is_mip) {
+        REQUIRE(highs_hbm.getBasis().valid);
+        REQUIRE(highs_hbm.getBasis().col_status ==
+                highs.getBasis().col_status);
+        REQUIRE(highs_hbm.getBasis().row_status ==
+                highs.getBasis().row_status);
+      }
+      REQUIRE(highs_hbm.run() == HighsStatus::kOk);
+      REQUIRE(std::fabs(highs_hbm.getInfo().objective_function_value -
+                        highs.getInfo().objective_function_value) < 1e-8);
+      std::remove(filename.c_str());
+    }
+  }
+
+  // A corrupted file is rejected
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  REQUIRE(highs.readModel(std::string(HIGHS_DIR) +
+                          "/check/instances/adlittle.mps") == HighsStatus::kOk);
+  const std::string filename = "test.hbm";
+  REQUIRE(highs.writeModel(filename) == HighsStatus::kOk);
+  FILE* file = fopen(filename.c_str(), "r+b");
+  REQUIRE(file != nullptr);
+  fseek(file, 200, SEEK_SET);
+  int byte = fgetc(file);
+  fseek(file, 200, SEEK_SET);
+  fputc(byte ^ 1, file);
+  fclose(file);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kError);
+
+  // A corrupted number of columns is rejected without first sizing
+  // the vectors of the model from it. The number of columns follows
+  // the 18-byte header, and the tag and size of the dimensions section
+  REQUIRE(highs.writeModel(filename) == HighsStatus::kOk);
+  file = fopen(filename.c_str(), "r+b");
+  REQUIRE(file != nullptr);
+  const int64_t num_col = kHighsIInf;
+  fseek(file, 30, SEEK_SET);
+  fwrite(&num_col, sizeof(num_col), 1, file);
+  fclose(file);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kError);
+  std::remove(filename.c_str());
+}
+
+TEST_CASE("filereader-write-gz", "[highs_filereader]") {
+  // Write a MIP as MPS and LP files, compressed if zlib is available,
+  // and check that the model is read back
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  REQUIRE(highs.readModel(std::string(HIGHS_DIR) +
+                          "/check/instances/flugpl.mps") == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const double objective_function_value =
+      highs.getInfo().objective_function_value;
+  std::vector<std::string> filenames = {"flugpl.mps", "flugpl.lp"};
+#ifdef ZLIB_FOUND
+  filenames.push_back("flugpl.mps.gz");
+  filenames.push_back("flugpl.lp.gz");
+#endif
+  for (const std::string& filename : filenames) {
+    REQUIRE(highs.writeModel(filename) == HighsStatus::kOk);
+    Highs highs_read;
+    highs_read.setOptionValue("output_flag", dev_run);
+    REQUIRE(highs_read.readModel(filename) == HighsStatus::kOk);
+    REQUIRE(highs_read.getLp().num_col_ == highs.getLp().num_col_);
+    REQUIRE(highs_read.getLp().a_matrix_.numNz() ==
+            highs.getLp().a_matrix_.numNz());
+    REQUIRE(highs_read.run() == HighsStatus::kOk);
+    REQUIRE(std::fabs(highs_read.getInfo().objective_function_value -
+                      objective_function_value) < 1e-6);
+    std::remove(filename.c_str());
+  }
+
+  // A MIP with enough nonzeros for the blocks of the COLUMNS section
+  // and of the constraint rows to be written in more than one round
+  // with two threads. Its values have short exact decimal forms, so
+  // that it is read back unchanged
+  const HighsInt num_col = 20000;
+  const HighsInt num_row = 10000;
+  const HighsInt col_count = 30;
+  HighsLp lp;
+  lp.num_col_ = num_col;
+  lp.num_row_ = num_row;
+  lp.a_matrix_.num_col_ = num_col;
+  lp.a_matrix_.num_row_ = num_row;
+  lp.a_matrix_.start_.assign(1, 0);
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    lp.col_names_.push_back("c" + std::to_string(iCol));
+    lp.col_cost_.push_back(1 + iCol % 7);
+    lp.col_lower_.push_back(0);
+    lp.col_upper_.push_back(iCol % 5 == 0 ? kHighsInf : 10);
+    lp.integrality_.push_back(iCol % 3 == 0 ? HighsVarType::kInteger
+                                            : HighsVarType::kContinuous);
+    // the entries of a column are in row order, as when read from an
+    // LP file
+    for (HighsInt k = 0; k < col_count; k++)
+      lp.a_matrix_.index_.push_back((iCol * 7 + k * 331) % num_row);
+    std::sort(lp.a_matrix_.index_.end() - col_count,
+              lp.a_matrix_.index_.end());
+    for (HighsInt k = 0; k < col_count; k++)
+      lp.a_matrix_.value_.push_back(0.25 * (1 + (iCol + k) % 13));
+    lp.a_matrix_.start_.push_back(lp.a_matrix_.index_.size());
+  }
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    lp.row_names_.push_back("r" + std::to_string(iRow));
+    lp.row_lower_.push_back(iRow % 2 == 0 ? 10 : -kHighsInf);
+    lp.row_upper_.push_back(iRow % 2 == 0 ? kHighsInf : 500);
+  }
+  std::vector<std::string> large_filenames = {"large.mps", "large.lp"};
+#ifdef ZLIB_FOUND
+  large_filenames.push_back("large.mps.gz");
+  large_filenames.push_back("large.lp.gz");
+#endif
+  auto fileContents = [](const std::string& filename) {
+    std::ifstream file(filename, std::ios::binary);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+  };
+  for (const std::string& filename : large_filenames) {
+    // The file written with two threads is the same as that written
+    // with one
+    std::string contents[2];
+    for (HighsInt threads = 1; threads <= 2; threads++) {
+      Highs::resetGlobalScheduler(true);
+      Highs highs_write;
+      highs_write.setOptionValue("output_flag", dev_run);
+      highs_write.setOptionValue("threads", threads);
+      REQUIRE(highs_write.passModel(lp) == HighsStatus::kOk);
+      REQUIRE(highs_write.writeModel(filename) == HighsStatus::kOk);
+      contents[threads - 1] = fileContents(filename);
+    }
+    Highs::resetGlobalScheduler(true);
+    REQUIRE(!contents[0].empty());
+    REQUIRE(contents[1] == contents[0]);
+    Highs highs_read;
+    highs_read.setOptionValue("output_flag", dev_run);
+    REQUIRE(highs_read.readModel(filename) == HighsStatus::kOk);
+    HighsLp read_lp = highs_read.getLp();
+    read_lp.a_matrix_.ensureColwise();
+    read_lp.model_name_ = lp.model_name_;
+    REQUIRE(read_lp.equalButForNames(lp));
+    REQUIRE(read_lp.integrality_ == lp.integrality_);
+    std::remove(filename.c_str());
+  }
+}
+
+TEST_CASE("filereader-keep-names", "[highs_filereader]") {
+  // With keep_names false, models are read without row and column
+  // names, whichever reader is used
+  const std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  const HighsLp lp = highs.getLp();
+  REQUIRE(lp.col_names_.size() == static_cast<size_t>(lp.num_col_));
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const double objective_function_value =
+      highs.getInfo().objective_function_value;
+
+  for (HighsInt k = 0; k < 2; k++) {
+    const bool mps_parser_type_free = k == 0;
+    Highs highs_unnamed;
+    highs_unnamed.setOptionValue("output_flag", dev_run);
+    highs_unnamed.setOptionValue("keep_names", false);
+    highs_unnamed.setOptionValue("mps_parser_type_free",
+                                 mps_parser_type_free);
+    REQUIRE(highs_unnamed.readModel(filename) == HighsStatus::kOk);
+    REQUIRE(highs_unnamed.getLp().col_names_.empty());
+    REQUIRE(highs_unnamed.getLp().row_names_.empty());
+    REQUIRE(highs_unnamed.getLp().equalButForNames(lp));
+    REQUIRE(highs_unnamed.run() == HighsStatus::kOk);
+    REQUIRE(std::fabs(highs_unnamed.getInfo().objective_function_value -
+                      objective_function_value) < 1e-8);
+  }
+
+  highs.setOptionValue("keep_names", false);
+  REQUIRE(highs.readModel(std::string(HIGHS_DIR) +
+                          "/check/instances/qjh.lp") == HighsStatus::kOk);
+  REQUIRE(highs.getLp().num_col_ > 0);
+  REQUIRE(highs.getLp().col_names_.empty());
+}
@@ -4,6 +4,7 @@
 #include "catch.hpp"
 #include "util/HighsHash.h"
 #include "util/HighsHashTree.h"
+#include "util/HighsNameTable.h"
 
 TEST_CASE("Highs_log2i", "[util]") {
   // test 32 bit and 64 bit values whoes log2 value should be floored
@@ -124,3 +125,32 @@ TEST_CASE("Highs_HashTree", "[util]") {
     }
   }
 }
+
+TEST_CASE("Highs_NameTable", "[util]") {
+  HighsNameTable table;
+  REQUIRE(table.find("x") == nullptr);
+  REQUIRE(table.insert("x", 3));
+  REQUIRE(table.insert("", -1));
+  REQUIRE(table.insert("xx", 5));
+  REQUIRE(!table.insert("x", 7));
+  REQUIRE(*table.find("x") == 3);
+  REQUIRE(*table.find("") == -1);
+  REQUIRE(*table.find("xx") == 5);
+  REQUIRE(table.find("xxx") == nullptr);
+
+  // A name can be found from part of a longer string
+  const std::string line = "xx  ROW1";
+  REQUIRE(*table.find(line.data(), 2) == 5);
+  REQUIRE(*table.find(line.data(), 1) == 3);
+
+  constexpr int NUM_CHECK = 10000;
+  for (int i = 0; i < NUM_CHECK; ++i)
+    REQUIRE(table.insert("c" + std::to_string(i), i));
+  REQUIRE(table.size() == NUM_CHECK + 3);
+  for (int i = 0; i < NUM_CHECK; ++i)
+    REQUIRE(*table.find("c" + std::to_string(i)) == i);
+
+  table.clear();
+  REQUIRE(table.size() == 0);
+  REQUIRE(table.find("x") == nullptr);
+}
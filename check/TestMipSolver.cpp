@@ -1,7 +1,12 @@
+#include <fstream>
+
 #include "HCheckConfig.h"
 #include "Highs.h"
 #include "SpecialLps.h"
 #include "catch.hpp"
+#include "mip/HighsMipCheckpoint.h"
+#include "mip/HighsMipSolver.h"
+#include "mip/HighsMipSolverData.h"
 
 const bool dev_run = false;
 const double double_equal_tolerance = 1e-5;
@@ -16,6 +21,7 @@ void solve(Highs& highs, std::string presolve,
            const double require_iteration_count = -1);
 void distillationMIP(Highs& highs);
 void rowlessMIP(Highs& highs);
+HighsLp readMip(const std::string& model);
 
 TEST_CASE("MIP-distillation", "[highs_test_mip_solver]") {
   Highs highs;
@@ -571,6 +577,20 @@ TEST_CASE("MIP-get-saved-solutions", "[highs_test_mip_solver]") {
   for (HighsInt iCol = 0; iCol < highs.getLp().num_col_; iCol++)
     REQUIRE(saved_objective_and_solution[last_saved_solution].col_value[iCol] ==
             highs.getSolution().col_value[iCol]);
+  // The improving solutions are written in the background, and the
+  // file is complete once run() returns
+  std::ifstream file(solution_file);
+  std::string line;
+  HighsInt num_written_solution = 0;
+  double last_written_objective = kHighsInf;
+  while (std::getline(file, line)) {
+    if (line.compare(0, 10, "Objective ") != 0) continue;
+    num_written_solution++;
+    last_written_objective = std::stod(line.substr(10));
+  }
+  REQUIRE(num_written_solution == num_saved_solution);
+  REQUIRE(std::fabs(last_written_objective -
+                    highs.getInfo().objective_function_value) < 1e-6);
   std::remove(solution_file.c_str());
 }
 
@@ -752,3 +772,369 @@ void rowlessMIP(Highs& highs) {
   solve(highs, "on", require_model_status, optimal_objective);
   solve(highs, "off", require_model_status, optimal_objective);
 }
+
+HighsLp readMip(const std::string& model) {
+  // The MIP is returned to be solved by a HighsMipSolver, rather than
+  // through Highs, so that the statistics of the solver can be checked
+  // once it has finished. This needs the scheduler to be running
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  highs::parallel::initialize_scheduler();
+  HighsLp lp = highs.getLp();
+  lp.a_matrix_.ensureColwise();
+  return lp;
+}
+
+TEST_CASE("MIP-threads-same-result", "[highs_test_mip_solver]") {
+  // with more than one thread, root strong branching candidates are
+  // evaluated concurrently, and probing implications are computed in
+  // parallel batches. The search path may differ, but the result may not
+  const std::vector<std::string> models = {"bell5", "egout", "lseu"};
+  for (const std::string& model : models) {
+    const std::string model_file =
+        std::string(HIGHS_DIR) + "/check/instances/" + model + ".mps";
+    std::vector<HighsModelStatus> model_status;
+    std::vector<double> objective;
+    for (HighsInt threads = 1; threads <= 4; threads += 3) {
+      Highs::resetGlobalScheduler(true);
+      Highs highs;
+      highs.setOptionValue("output_flag", dev_run);
+      highs.setOptionValue("threads", threads);
+      highs.readModel(model_file);
+      highs.run();
+      model_status.push_back(highs.getModelStatus());
+      objective.push_back(highs.getInfo().objective_function_value);
+    }
+    REQUIRE(model_status[0] == HighsModelStatus::kOptimal);
+    REQUIRE(model_status[1] == model_status[0]);
+    REQUIRE(objectiveOk(objective[1], objective[0], dev_run));
+  }
+  Highs::resetGlobalScheduler(true);
+}
+
+TEST_CASE("MIP-checkpoint-resume", "[highs_test_mip_solver]") {
+  const std::string checkpoint_file = "MipCheckpoint.txt";
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/bell5.mps";
+  std::remove(checkpoint_file.c_str());
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(model_file);
+  highs.setOptionValue("mip_checkpoint_file", checkpoint_file);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double optimal_objective = highs.getInfo().objective_function_value;
+  // there is nothing to resume once the MIP is solved, so no
+  // checkpoint is written
+  REQUIRE(!std::ifstream(checkpoint_file).good());
+
+  // stop the search early, leaving open nodes in the checkpoint
+  highs.clearSolver();
+  highs.setOptionValue("mip_max_nodes", 20);
+  highs.run();
+  REQUIRE(highs.getModelStatus() != HighsModelStatus::kOptimal);
+  HighsMipCheckpoint checkpoint;
+  REQUIRE(checkpoint.read(checkpoint_file));
+  REQUIRE(!checkpoint.nodes.empty());
+
+  // the search resumes from the open nodes of the checkpoint, rather
+  // than from the root, with its incumbent as the start solution
+  {
+    const HighsLp lp = readMip("bell5");
+    HighsOptions options;
+    options.output_flag = dev_run;
+    HighsCallback callback;
+    HighsSolution solution;
+    solution.col_value = checkpoint.incumbent;
+    solution.value_valid = !checkpoint.incumbent.empty();
+    if (solution.value_valid)
+      lp.a_matrix_.productQuad(solution.row_value, solution.col_value);
+    HighsMipSolver mipsolver(callback, options, lp, solution);
+    mipsolver.checkpoint = &checkpoint;
+    mipsolver.run();
+    REQUIRE(mipsolver.modelstatus_ == HighsModelStatus::kOptimal);
+    REQUIRE(objectiveOk(mipsolver.solution_objective_, optimal_objective,
+                        dev_run));
+    REQUIRE(mipsolver.mipdata_->numCheckpointNodesRestored > 0);
+  }
+
+  Highs resumed;
+  resumed.setOptionValue("output_flag", dev_run);
+  resumed.readModel(model_file);
+  REQUIRE(resumed.resumeMip(checkpoint_file) == HighsStatus::kOk);
+  REQUIRE(resumed.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(objectiveOk(resumed.getInfo().objective_function_value,
+                      optimal_objective, dev_run));
+
+  // open nodes that are not for the presolved model cannot be restored
+  checkpoint.modelHash++;
+  REQUIRE(checkpoint.write(checkpoint_file));
+  REQUIRE(resumed.resumeMip(checkpoint_file) == HighsStatus::kError);
+  REQUIRE(resumed.getModelStatus() == HighsModelStatus::kSolveError);
+
+  REQUIRE(resumed.resumeMip("NonExistentCheckpoint.txt") ==
+          HighsStatus::kError);
+  std::remove(checkpoint_file.c_str());
+}
+
+TEST_CASE("MIP-node-queue-memory-limit", "[highs_test_mip_solver]") {
+  const HighsLp lp = readMip("bell5");
+  HighsOptions options;
+  options.output_flag = dev_run;
+  HighsCallback callback;
+  HighsSolution solution;
+  double optimal_objective;
+  {
+    HighsMipSolver mipsolver(callback, options, lp, solution);
+    mipsolver.run();
+    REQUIRE(mipsolver.modelstatus_ == HighsModelStatus::kOptimal);
+    REQUIRE(mipsolver.mipdata_->nodequeue.numNodesSpilled() == 0);
+    optimal_objective = mipsolver.solution_objective_;
+  }
+
+  // with a tiny limit most open nodes are spilled to the temporary file
+  options.mip_node_queue_memory_limit = 0.001;
+  HighsMipSolver mipsolver(callback, options, lp, solution);
+  mipsolver.run();
+  REQUIRE(mipsolver.modelstatus_ == HighsModelStatus::kOptimal);
+  REQUIRE(objectiveOk(mipsolver.solution_objective_, optimal_objective,
+                      dev_run));
+  REQUIRE(mipsolver.mipdata_->nodequeue.numNodesSpilled() > 0);
+  REQUIRE(!mipsolver.mipdata_->nodequeue.spilledNodesLost());
+}
+
+TEST_CASE("MIP-parallel-clique-extraction", "[highs_test_mip_solver]") {
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/p0548.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(model_file);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  const double optimal_objective = highs.getInfo().objective_function_value;
+
+  // the rows are scanned in parallel if switched on and more than one
+  // thread is available
+  highs.clearSolver();
+  highs.setOptionValue("mip_parallel_clique_extraction", true);
+  highs.setOptionValue("mip_min_cliquetable_entries_for_parallelism", 0);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(objectiveOk(highs.getInfo().objective_function_value,
+                      optimal_objective, dev_run));
+}
+
+TEST_CASE("MIP-parallel-clique-extraction-threads",
+          "[highs_test_mip_solver]") {
+  // set packing, knapsack and implication rows on binary columns, with
+  // enough rows for the parallel scan to take more than one round
+  const HighsInt num_col = 1000;
+  const HighsInt num_row = 6000;
+  HighsLp lp;
+  lp.num_col_ = num_col;
+  lp.num_row_ = num_row;
+  lp.col_cost_.assign(num_col, -1);
+  lp.col_lower_.assign(num_col, 0);
+  lp.col_upper_.assign(num_col, 1);
+  lp.integrality_.assign(num_col, HighsVarType::kInteger);
+  lp.row_lower_.assign(num_row, -kHighsInf);
+  lp.a_matrix_.format_ = MatrixFormat::kRowwise;
+  lp.a_matrix_.num_col_ = num_col;
+  lp.a_matrix_.num_row_ = num_row;
+  lp.a_matrix_.start_.assign(1, 0);
+  uint32_t seed = 1;
+  auto random = [&](uint32_t n) {
+    seed = seed * 1664525 + 1013904223;
+    return (seed >> 8) % n;
+  };
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    const HighsInt length = 2 + random(5);
+    const HighsInt step = 1 + random(13);
+    double sum = 0;
+    double max_value = 0;
+    for (HighsInt k = 0; k < length; k++) {
+      lp.a_matrix_.index_.push_back((iRow * 7 + k * step) % num_col);
+      double value = 1;
+      if (iRow % 4 == 2) value = 3 + random(7);
+      if (iRow % 4 == 3 && k == 0) value = -1;
+      lp.a_matrix_.value_.push_back(value);
+      sum += value;
+      max_value = std::max(value, max_value);
+    }
+    lp.a_matrix_.start_.push_back(lp.a_matrix_.index_.size());
+    double upper = 1;
+    if (iRow % 4 == 2) upper = std::max(max_value, std::floor(0.6 * sum));
+    if (iRow % 4 == 3) upper = length - 2;
+    lp.row_upper_.push_back(upper);
+  }
+  lp.a_matrix_.ensureColwise();
+
+  // the clique table of each scan, with one and with four threads
+  std::vector<std::vector<HighsCliqueTable::CliqueVar>> cliques[2][2];
+  for (HighsInt parallel = 0; parallel < 2; parallel++) {
+    for (HighsInt threads = 1; threads <= 4; threads += 3) {
+      Highs::resetGlobalScheduler(true);
+      highs::parallel::initialize_scheduler(threads);
+      HighsOptions options;
+      options.output_flag = dev_run;
+      options.mip_parallel_clique_extraction = parallel;
+      HighsCallback callback;
+      HighsSolution solution;
+      HighsMipSolver mipsolver(callback, options, lp, solution);
+      mipsolver.mipdata_.reset(new HighsMipSolverData(mipsolver));
+      mipsolver.mipdata_->init();
+      mipsolver.mipdata_->setupDomainPropagation();
+      HighsCliqueTable& cliquetable = mipsolver.mipdata_->cliquetable;
+      // scan the rows in blocks even with one thread
+      cliquetable.setMinEntriesForParallelism(0);
+      cliquetable.extractCliques(mipsolver);
+      REQUIRE(!mipsolver.mipdata_->domain.infeasible());
+      if (dev_run)
+        printf("Clique table with parallel = %d and threads = %d has %d "
+               "cliques and %d entries\n",
+               int(parallel), int(threads), int(cliquetable.numCliques()),
+               int(cliquetable.getNumEntries()));
+      cliques[parallel][threads > 1] = cliquetable.getCliques();
+      REQUIRE(cliques[parallel][threads > 1].size() ==
+              size_t(cliquetable.numCliques()));
+    }
+  }
+  Highs::resetGlobalScheduler(true);
+  REQUIRE(cliques[0][0].size() > 0);
+  REQUIRE(cliques[1][0].size() > 0);
+  // the table doesn't depend on the number of threads
+  REQUIRE(cliques[0][1] == cliques[0][0]);
+  REQUIRE(cliques[1][1] == cliques[1][0]);
+}
+
+TEST_CASE("MIP-restart-transfer-cuts", "[highs_test_mip_solver]") {
+  // lseu restarts after the root node, and the cuts of the pool that
+  // stay valid are transferred to the presolved model. The primal
+  // heuristics are off, so the transfer isn't to a sub-MIP
+  const HighsLp lp = readMip("lseu");
+  HighsOptions options;
+  options.output_flag = dev_run;
+  options.mip_heuristic_effort = 0;
+  HighsCallback callback;
+  HighsSolution solution;
+  HighsMipSolver mipsolver(callback, options, lp, solution);
+  mipsolver.run();
+  REQUIRE(mipsolver.modelstatus_ == HighsModelStatus::kOptimal);
+  REQUIRE(objectiveOk(mipsolver.solution_objective_, 1120, dev_run));
+  REQUIRE(mipsolver.mipdata_->numRestarts > 0);
+  REQUIRE(mipsolver.mipdata_->numRestartCutsTransferred > 0);
+}
+
+TEST_CASE("MIP-sub-mip-parent-cuts", "[highs_test_mip_solver]") {
+  // The rows of lseu are valid cuts for a sub-MIP of lseu with some
+  // columns fixed, and are transferred to its cut pool from a parent
+  // pool, with the fixed columns substituted
+  const std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/lseu.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.readModel(model_file);
+  // solving the model also starts the scheduler used by the MIP solver
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  HighsLp lp = highs.getLp();
+  lp.a_matrix_.ensureColwise();
+  HighsOptions options;
+  options.output_flag = dev_run;
+  HighsCallback callback;
+  HighsSolution solution;
+
+  HighsMipSolver parent(callback, options, lp, solution);
+  parent.mipdata_.reset(new HighsMipSolverData(parent));
+  parent.mipdata_->init();
+  parent.mipdata_->setupDomainPropagation();
+  HighsCutPool parentpool(lp.num_col_, 10, 100);
+  HighsSparseMatrix row_matrix;
+  row_matrix.createRowwise(lp.a_matrix_);
+  for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++) {
+    if (lp.row_upper_[iRow] == kHighsInf) continue;
+    const HighsInt start = row_matrix.start_[iRow];
+    const HighsInt len = row_matrix.start_[iRow + 1] - start;
+    std::vector<HighsInt> index(&row_matrix.index_[start],
+                                &row_matrix.index_[start] + len);
+    std::vector<double> value(&row_matrix.value_[start],
+                              &row_matrix.value_[start] + len);
+    parentpool.addCut(parent, index.data(), value.data(), len,
+                      lp.row_upper_[iRow], false, false, false);
+  }
+  REQUIRE(parentpool.getNumCuts() > 0);
+
+  // fix every fourth column at zero
+  HighsLp sublp = lp;
+  for (HighsInt iCol = 0; iCol < sublp.num_col_; iCol += 4)
+    sublp.col_upper_[iCol] = 0;
+  HighsMipSolver submip(callback, options, sublp, solution, true);
+  submip.mipdata_.reset(new HighsMipSolverData(submip));
+  submip.mipdata_->init();
+  submip.mipdata_->runPresolve(-1);
+  REQUIRE(submip.modelstatus_ == HighsModelStatus::kNotset);
+  submip.mipdata_->runSetup();
+  const HighsInt num_cut = submip.mipdata_->cutpool.getNumCuts();
+  submip.mipdata_->transferParentCuts(parentpool);
+  REQUIRE(submip.mipdata_->cutpool.getNumCuts() > num_cut);
+}
+
+TEST_CASE("MIP-heuristic-scheduling", "[highs_test_mip_solver]") {
+  // The calls of the primal heuristics are recorded in their statistics
+  const HighsLp lp = readMip("lseu");
+  HighsOptions options;
+  options.output_flag = dev_run;
+  {
+    HighsCallback callback;
+    HighsSolution solution;
+    HighsMipSolver mipsolver(callback, options, lp, solution);
+    mipsolver.run();
+    REQUIRE(mipsolver.modelstatus_ == HighsModelStatus::kOptimal);
+    const HighsPrimalHeuristics::HeuristicStatistics& stats =
+        mipsolver.mipdata_->heuristics.getStatistics(
+            HighsPrimalHeuristics::kHeuristicRens);
+    REQUIRE(stats.numCalls > 0);
+    REQUIRE(stats.numSkipped == 0);
+  }
+
+  // Unless scheduling is switched on, RINS is called whenever it is
+  // considered. Otherwise it is called unconditionally for its first
+  // calls, and then less often if it keeps failing to find improving
+  // solutions, with the calls that are skipped being counted
+  const HighsPrimalHeuristics::Heuristic heuristic =
+      HighsPrimalHeuristics::kHeuristicRins;
+  const HighsInt num_call = 30;
+  for (HighsInt k = 0; k < 2; k++) {
+    options.mip_heuristic_scheduling = k == 1;
+    HighsCallback callback;
+    HighsSolution solution;
+    HighsMipSolver mipsolver(callback, options, lp, solution);
+    mipsolver.timer_.start(mipsolver.timer_.solve_clock);
+    mipsolver.mipdata_.reset(new HighsMipSolverData(mipsolver));
+    mipsolver.mipdata_->init();
+    mipsolver.mipdata_->runPresolve(-1);
+    REQUIRE(mipsolver.modelstatus_ == HighsModelStatus::kNotset);
+    mipsolver.mipdata_->runSetup();
+    mipsolver.mipdata_->evaluateRootNode();
+    REQUIRE(!mipsolver.mipdata_->incumbent.empty());
+    HighsPrimalHeuristics& heuristics = mipsolver.mipdata_->heuristics;
+    REQUIRE(heuristics.getStatistics(heuristic).numCalls == 0);
+    const std::vector<double> point =
+        mipsolver.mipdata_->lp.getLpSolver().getSolution().col_value;
+    for (HighsInt iCall = 0; iCall < num_call; iCall++)
+      if (heuristics.heuristicScheduled(heuristic)) heuristics.RINS(point);
+    const HighsPrimalHeuristics::HeuristicStatistics& stats =
+        heuristics.getStatistics(heuristic);
+    REQUIRE(stats.numCalls + stats.numSkipped == num_call);
+    REQUIRE(stats.numSuccess == 0);
+    if (k == 0) {
+      REQUIRE(stats.numSkipped == 0);
+    } else {
+      REQUIRE(stats.numCalls >= 5);
+      REQUIRE(stats.numSkipped > 0);
+    }
+  }
+}
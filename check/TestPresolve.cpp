@@ -1,7 +1,10 @@
+#include <fstream>
+
 #include "HCheckConfig.h"
 #include "Highs.h"
 #include "SpecialLps.h"
 #include "catch.hpp"
+#include "lp_data/HighsModelUtils.h"
 
 const bool dev_run = false;
 
@@ -11,6 +14,7 @@ bool doubleEqual(const double v0, const double v1) {
 
 void presolveSolvePostsolve(const std::string& model_file,
                             const bool solve_relaxation = false);
+void presolveDominatedColumns(const HighsInt threads);
 
 TEST_CASE("presolve-solve-postsolve-lp", "[highs_test_presolve]") {
   std::string model_file =
@@ -83,6 +87,110 @@ TEST_CASE("postsolve-no-basis", "[highs_test_presolve]") {
   }
 }
 
+TEST_CASE("presolve-decompose-lp", "[highs_test_presolve]") {
+  // Solve an LP consisting of independent copies of adlittle, with
+  // and without solving the blocks of the presolved LP separately
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  highs.readModel(model_file);
+  highs.run();
+  const double objective_function_value =
+      highs.getInfo().objective_function_value;
+  const HighsLp lp = highs.getLp();
+  const HighsInt num_block = 3;
+  highs.clearModel();
+  for (HighsInt iBlock = 0; iBlock < num_block; iBlock++) {
+    const HighsInt row_offset = iBlock * lp.num_row_;
+    std::vector<HighsInt> index = lp.a_matrix_.index_;
+    for (HighsInt& iRow : index) iRow += row_offset;
+    REQUIRE(highs.addRows(lp.num_row_, lp.row_lower_.data(),
+                          lp.row_upper_.data(), 0, nullptr, nullptr,
+                          nullptr) == HighsStatus::kOk);
+    REQUIRE(highs.addCols(lp.num_col_, lp.col_cost_.data(),
+                          lp.col_lower_.data(), lp.col_upper_.data(),
+                          lp.a_matrix_.numNz(), lp.a_matrix_.start_.data(),
+                          index.data(),
+                          lp.a_matrix_.value_.data()) == HighsStatus::kOk);
+  }
+  // The logging is passed to a callback, which records it, and can
+  // interrupt the simplex solver
+  struct CallbackData {
+    std::string log;
+    bool interrupt = false;
+  } callback_data;
+  auto callback = [](int callback_type, const std::string& message,
+                     const HighsCallbackDataOut* data_out,
+                     HighsCallbackDataIn* data_in, void* user_callback_data) {
+    CallbackData& data = *static_cast<CallbackData*>(user_callback_data);
+    if (callback_type == kCallbackLogging) {
+      if (dev_run) printf("%s", message.c_str());
+      data.log += message;
+    } else if (callback_type == kCallbackSimplexInterrupt) {
+      data_in->user_interrupt = data.interrupt;
+    }
+  };
+  highs.setOptionValue("output_flag", true);
+  highs.setCallback(callback, &callback_data);
+  highs.startCallback(kCallbackLogging);
+  highs.startCallback(kCallbackSimplexInterrupt);
+  const std::string decomposed = "Solving the presolved LP as 3 independent";
+  for (HighsInt k = 0; k < 2; k++) {
+    highs.clearSolver();
+    highs.setOptionValue("lp_presolve_decompose", k == 1);
+    callback_data.log.clear();
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    REQUIRE(std::fabs(highs.getInfo().objective_function_value -
+                      num_block * objective_function_value) <=
+            1e-6 * std::max(1.0, std::fabs(objective_function_value)));
+    REQUIRE((callback_data.log.find(decomposed) != std::string::npos) ==
+            (k == 1));
+  }
+  // The callback interrupts the solution of the blocks
+  highs.clearSolver();
+  callback_data.log.clear();
+  callback_data.interrupt = true;
+  highs.run();
+  REQUIRE(callback_data.log.find(decomposed) != std::string::npos);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInterrupt);
+}
+
+TEST_CASE("presolve-decompose-lp-status", "[highs_test_presolve]") {
+  // Solve an LP whose presolved LP has an unbounded block and an
+  // infeasible block, so the LP is infeasible. The final row and
+  // column are removed by presolve.
+  const double inf = kHighsInf;
+  HighsLp lp;
+  lp.num_col_ = 8;
+  lp.num_row_ = 6;
+  lp.col_cost_ = {-3, -2, -2, -1, 1, 1, 1, 1};
+  lp.col_lower_ = {0, 0, 0, 0, 0, 0, 0, 0};
+  lp.col_upper_ = {inf, inf, inf, inf, 10, 10, 10, 10};
+  lp.row_lower_ = {-inf, -inf, -inf, 10, -inf, -inf};
+  lp.row_upper_ = {2, 2, 2, inf, 2, 5};
+  lp.a_matrix_.format_ = MatrixFormat::kRowwise;
+  lp.a_matrix_.start_ = {0, 4, 7, 10, 13, 16, 17};
+  lp.a_matrix_.index_ = {0, 1, 2, 3, 0, 2, 3, 0, 1, 2, 4, 5, 6, 4, 5, 6, 7};
+  lp.a_matrix_.value_ = {-3, 1, -1, 3, 1, 2, -3, 3, -3, -2,
+                         1,  2, 3,  2, 1, 1, 1};
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+  for (HighsInt k = 0; k < 2; k++) {
+    highs.clearSolver();
+    highs.setOptionValue("lp_presolve_decompose", k == 1);
+    highs.run();
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kInfeasible);
+  }
+  // Without the infeasible block the LP is unbounded
+  const std::vector<HighsInt> infeasible_row = {3, 4};
+  REQUIRE(highs.deleteRows(2, infeasible_row.data()) == HighsStatus::kOk);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kUnbounded);
+}
+
 TEST_CASE("presolve-solve-postsolve-mip", "[highs_test_presolve]") {
   std::string model_file =
       std::string(HIGHS_DIR) + "/check/instances/flugpl.mps";
@@ -601,3 +709,177 @@ TEST_CASE("write-presolved-model", "[highs_test_presolve]") {
   REQUIRE(highs.getInfo().simplex_iteration_count == -1);
   std::remove(presolved_model_file.c_str());
 }
+
+TEST_CASE("presolve-log-file", "[highs_test_presolve]") {
+  // The JSON presolve log has an entry for each presolve pass, with
+  // the statistics returned by getPresolveLog()
+  const std::string presolve_log_file = "presolve_log.json";
+  std::string model_file =
+      std::string(HIGHS_DIR) + "/check/instances/p0548.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("presolve_log_file", presolve_log_file);
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  REQUIRE(highs.presolve() == HighsStatus::kOk);
+  const HighsPresolveLog& presolve_log = highs.getPresolveLog();
+  REQUIRE(HighsInt(presolve_log.pass.size()) == kPresolvePassCount);
+
+  std::ifstream file(presolve_log_file);
+  REQUIRE(file.is_open());
+  const std::string pass_key = "\"pass\": \"";
+  const std::string calls_key = "\"calls\": ";
+  const std::string cols_removed_key = "\"cols_removed\": ";
+  std::string line;
+  HighsInt pass_type = kPresolvePassMin;
+  while (std::getline(file, line)) {
+    const size_t pass_pos = line.find(pass_key);
+    if (pass_pos == std::string::npos) continue;
+    REQUIRE(pass_type < kPresolvePassCount);
+    const size_t name_pos = pass_pos + pass_key.size();
+    REQUIRE(line.substr(name_pos, line.find('"', name_pos) - name_pos) ==
+            utilPresolvePassTypeToString(pass_type));
+    const size_t calls_pos = line.find(calls_key);
+    const size_t cols_removed_pos = line.find(cols_removed_key);
+    REQUIRE(calls_pos != std::string::npos);
+    REQUIRE(cols_removed_pos != std::string::npos);
+    REQUIRE(std::atoi(line.c_str() + calls_pos + calls_key.size()) ==
+            presolve_log.pass[pass_type].call);
+    REQUIRE(std::atoi(line.c_str() + cols_removed_pos +
+                      cols_removed_key.size()) ==
+            presolve_log.pass[pass_type].col_removed);
+    pass_type++;
+  }
+  REQUIRE(pass_type == kPresolvePassCount);
+  REQUIRE(presolve_log.pass[kPresolvePassFastLoop].call > 0);
+  REQUIRE(presolve_log.pass[kPresolvePassFastLoop].nz_touched > 0);
+  REQUIRE(presolve_log.pass[kPresolvePassProbing].call > 0);
+  file.close();
+
+  // For an LP, the log also has the statistics of the presolve rules
+  model_file = std::string(HIGHS_DIR) + "/check/instances/adlittle.mps";
+  REQUIRE(highs.readModel(model_file) == HighsStatus::kOk);
+  REQUIRE(highs.presolve() == HighsStatus::kOk);
+  HighsInt num_rule_removed = 0;
+  for (const HighsPresolveRuleLog& rule_log : highs.getPresolveLog().rule)
+    num_rule_removed += rule_log.col_removed + rule_log.row_removed;
+  REQUIRE(num_rule_removed > 0);
+  file.open(presolve_log_file);
+  std::string contents((std::istreambuf_iterator<char>(file)),
+                       std::istreambuf_iterator<char>());
+  file.close();
+  REQUIRE(contents.find("\"rules\": [") != std::string::npos);
+  REQUIRE(contents.find("\"nonzeros_touched\": ") != std::string::npos);
+
+  // The log is also written when presolve finds the model to be
+  // infeasible
+  std::remove(presolve_log_file.c_str());
+  HighsLp lp;
+  lp.num_col_ = 1;
+  lp.num_row_ = 1;
+  lp.col_cost_ = {1};
+  lp.col_lower_ = {1};
+  lp.col_upper_ = {2};
+  lp.row_lower_ = {-kHighsInf};
+  lp.row_upper_ = {0};
+  lp.a_matrix_.start_ = {0, 1};
+  lp.a_matrix_.index_ = {0};
+  lp.a_matrix_.value_ = {1};
+  REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+  highs.presolve();
+  REQUIRE(highs.getModelPresolveStatus() == HighsPresolveStatus::kInfeasible);
+  file.open(presolve_log_file);
+  REQUIRE(file.is_open());
+  file.close();
+  std::remove(presolve_log_file.c_str());
+}
+
+TEST_CASE("presolve-pass-work-limit", "[highs_test_presolve]") {
+  // With a work limit of zero, probing and sparsify are called but
+  // stop before making the reductions that they make without a limit
+  auto passLog = [](const std::string& model, const HighsInt work_limit) {
+    Highs highs;
+    highs.setOptionValue("output_flag", dev_run);
+    highs.setOptionValue("presolve_probing_work_limit", work_limit);
+    highs.setOptionValue("presolve_sparsify_work_limit", work_limit);
+    REQUIRE(highs.readModel(std::string(HIGHS_DIR) + "/check/instances/" +
+                            model + ".mps") == HighsStatus::kOk);
+    highs.presolve();
+    return highs.getPresolveLog();
+  };
+  HighsPresolveLog presolve_log = passLog("p0548", kHighsIInf);
+  const HighsInt probing_col_removed =
+      presolve_log.pass[kPresolvePassProbing].col_removed;
+  presolve_log = passLog("p0548", 0);
+  REQUIRE(presolve_log.pass[kPresolvePassProbing].call > 0);
+  REQUIRE(presolve_log.pass[kPresolvePassProbing].col_removed <
+          probing_col_removed);
+
+  presolve_log = passLog("egout", kHighsIInf);
+  REQUIRE(presolve_log.pass[kPresolvePassSparsify].nz_removed > 0);
+  presolve_log = passLog("egout", 0);
+  REQUIRE(presolve_log.pass[kPresolvePassSparsify].call > 0);
+  REQUIRE(presolve_log.pass[kPresolvePassSparsify].nz_removed == 0);
+}
+
+TEST_CASE("presolve-dominated-columns", "[highs_test_presolve]") {
+  presolveDominatedColumns(1);
+}
+
+TEST_CASE("presolve-dominated-columns-threads", "[highs_test_presolve]") {
+  // With more than one thread, the candidates of the long first row
+  // are checked in parallel, which must give the same reductions
+  presolveDominatedColumns(4);
+}
+
+void presolveDominatedColumns(const HighsInt threads) {
+  // A set covering problem where the first columns are only in the
+  // first row, which contains all columns, and are dominated by the
+  // cheaper columns
+  const HighsInt num_col = 300;
+  const HighsInt num_row = 30;
+  const HighsInt num_long_row_col = 20;
+  HighsLp lp;
+  lp.num_col_ = num_col;
+  lp.num_row_ = num_row;
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    lp.col_cost_.push_back(iCol < num_long_row_col ? 20 + iCol
+                                                   : 1 + (iCol * 3) % 17);
+    lp.col_lower_.push_back(0);
+    lp.col_upper_.push_back(1);
+    lp.integrality_.push_back(HighsVarType::kInteger);
+    lp.a_matrix_.start_.push_back(lp.a_matrix_.index_.size());
+    lp.a_matrix_.index_.push_back(0);
+    lp.a_matrix_.value_.push_back(1);
+    if (iCol < num_long_row_col) continue;
+    for (HighsInt iRow = 1; iRow < num_row; iRow++) {
+      if ((iCol * 7 + iRow * 13) % 29 >= 4) continue;
+      lp.a_matrix_.index_.push_back(iRow);
+      lp.a_matrix_.value_.push_back(1);
+    }
+  }
+  lp.a_matrix_.start_.push_back(lp.a_matrix_.index_.size());
+  lp.row_lower_.assign(num_row, 1);
+  lp.row_upper_.assign(num_row, kHighsInf);
+
+  Highs::resetGlobalScheduler(true);
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("threads", threads);
+  REQUIRE(highs.passModel(lp) == HighsStatus::kOk);
+  REQUIRE(highs.presolve() == HighsStatus::kOk);
+  const HighsPresolvePassLog& dominated =
+      highs.getPresolveLog().pass[kPresolvePassDominatedCols];
+  const HighsLp& presolved_lp = highs.getPresolvedLp();
+  // the reductions and the presolved model don't depend on the number
+  // of threads
+  REQUIRE(dominated.col_removed == 270);
+  REQUIRE(dominated.row_removed == 0);
+  REQUIRE(dominated.nz_removed == 1270);
+  REQUIRE(presolved_lp.num_col_ == 29);
+  REQUIRE(presolved_lp.num_row_ == 30);
+  REQUIRE(presolved_lp.a_matrix_.numNz() == 145);
+  highs.run();
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(highs.getInfo().objective_function_value == 10);
+  Highs::resetGlobalScheduler(true);
+}
@@ -5,6 +5,9 @@
 #include "Highs.h"
 #include "catch.hpp"
 #include "io/FilereaderLp.h"
+#include "qpsolver/basis.hpp"
+#include "qpsolver/factor.hpp"
+#include "util/HighsRandom.h"
 
 const bool dev_run = false;
 const double inf = kHighsInf;
@@ -149,6 +152,17 @@ TEST_CASE("qpsolver", "[qpsolver]") {
   return_status = highs.run();
   REQUIRE(return_status == HighsStatus::kError);
 
+  // Test that the MIQP can be solved by branch-and-bound, giving an
+  // integer solution
+  highs.setOptionValue("miqp_branch_and_bound", true);
+  return_status = highs.run();
+  REQUIRE(return_status == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    const double value = solution.col_value[iCol];
+    REQUIRE(fabs(value - std::round(value)) < double_equal_tolerance);
+  }
+
   // Test that attempting to solve MIQP relaxation is OK
   highs.setOptionValue("solve_relaxation", true);
   return_status = highs.run();
@@ -1012,3 +1026,425 @@ TEST_CASE("test-qp-terminations", "[qpsolver]") {
   REQUIRE(highs.getModelStatus() == HighsModelStatus::kSolveError);
   highs.setOptionValue("qp_nullspace_limit", 4000);
 }
+
+TEST_CASE("test-qp-ipx-diagonal", "[qpsolver]") {
+  // A strictly convex QP with a diagonal Hessian is solved by IPX when
+  // solver = ipm, and must have the same solution as with QUASS
+  HighsModel model;
+  model.lp_.num_col_ = 3;
+  model.lp_.num_row_ = 2;
+  model.lp_.col_cost_ = {-1, -2, 0};
+  model.lp_.col_lower_ = {0, 0, 0};
+  model.lp_.col_upper_ = {inf, 1, inf};
+  model.lp_.row_lower_ = {2, -inf};
+  model.lp_.row_upper_ = {inf, 3};
+  model.lp_.a_matrix_.format_ = MatrixFormat::kRowwise;
+  model.lp_.a_matrix_.start_ = {0, 3, 5};
+  model.lp_.a_matrix_.index_ = {0, 1, 2, 0, 2};
+  model.lp_.a_matrix_.value_ = {1, 1, 1, 1, -1};
+  model.hessian_.dim_ = model.lp_.num_col_;
+  model.hessian_.start_ = {0, 1, 2, 3};
+  model.hessian_.index_ = {0, 1, 2};
+  model.hessian_.value_ = {2, 2, 1};
+
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  for (HighsInt k = 0; k < 2; k++) {
+    if (k == 1) {
+      // Negate the objective and maximize
+      for (double& cost : model.lp_.col_cost_) cost = -cost;
+      for (double& value : model.hessian_.value_) value = -value;
+      model.lp_.sense_ = ObjSense::kMaximize;
+    }
+    REQUIRE(highs.passModel(model) == HighsStatus::kOk);
+    REQUIRE(highs.setOptionValue("solver", kHighsChooseString) ==
+            HighsStatus::kOk);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    const double quass_objective = highs.getInfo().objective_function_value;
+    const std::vector<double> quass_col_value = highs.getSolution().col_value;
+
+    highs.clearSolver();
+    REQUIRE(highs.setOptionValue("solver", kIpmString) == HighsStatus::kOk);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    REQUIRE(highs.getInfo().qp_iteration_count == 0);
+    REQUIRE(highs.getInfo().ipm_iteration_count > 0);
+    REQUIRE(fabs(highs.getInfo().objective_function_value - quass_objective) <
+            double_equal_tolerance);
+    const std::vector<double>& col_value = highs.getSolution().col_value;
+    for (HighsInt iCol = 0; iCol < model.lp_.num_col_; iCol++)
+      REQUIRE(fabs(col_value[iCol] - quass_col_value[iCol]) <
+              double_equal_tolerance);
+  }
+}
+
+TEST_CASE("test-qp-warm-start", "[qpsolver]") {
+  // After changing the costs or bounds of a QP, it is re-solved from
+  // the retained basis and solution, and must have the same optimal
+  // objective as when solved from scratch
+  const std::string filename =
+      std::string(HIGHS_DIR) + "/check/instances/primal1.mps";
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  const HighsInfo& info = highs.getInfo();
+  REQUIRE(highs.readModel(filename) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const HighsInt cold_iteration_count = info.qp_iteration_count;
+  const HighsLp& lp = highs.getLp();
+  const HighsInt num_col = lp.num_col_;
+
+  Highs cold_highs;
+  cold_highs.setOptionValue("output_flag", dev_run);
+  for (HighsInt k = 0; k < 3; k++) {
+    if (k == 0) {
+      // Perturb the costs
+      for (HighsInt iCol = 0; iCol < num_col; iCol += 3)
+        REQUIRE(highs.changeColCost(iCol, lp.col_cost_[iCol] + 0.1) ==
+                HighsStatus::kOk);
+    } else if (k == 1) {
+      // Tighten the upper bounds so that the solution is infeasible
+      const std::vector<double>& col_value = highs.getSolution().col_value;
+      for (HighsInt iCol = 0; iCol < num_col; iCol++)
+        if (col_value[iCol] > lp.col_lower_[iCol] + 0.1)
+          REQUIRE(highs.changeColBounds(iCol, lp.col_lower_[iCol],
+                                        col_value[iCol] - 0.05) ==
+                  HighsStatus::kOk);
+    } else {
+      // Relax the upper bounds so that the active bounds move away
+      // from the solution
+      for (HighsInt iCol = 0; iCol < num_col; iCol++)
+        REQUIRE(highs.changeColBounds(iCol, lp.col_lower_[iCol],
+                                      lp.col_upper_[iCol] + 0.1) ==
+                HighsStatus::kOk);
+    }
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    if (k == 0) REQUIRE(info.qp_iteration_count < cold_iteration_count);
+
+    REQUIRE(cold_highs.passModel(highs.getModel()) == HighsStatus::kOk);
+    REQUIRE(cold_highs.run() == HighsStatus::kOk);
+    REQUIRE(cold_highs.getModelStatus() == HighsModelStatus::kOptimal);
+    REQUIRE(fabs(info.objective_function_value -
+                 cold_highs.getInfo().objective_function_value) <
+            double_equal_tolerance *
+                std::max(1.0, fabs(info.objective_function_value)));
+  }
+}
+
+TEST_CASE("test-miqp", "[qpsolver]") {
+  // min (x0 - 0.4)^2 + (x1 - 1.6)^2 + x2^2 - x2 subject to
+  // x0 + x1 >= 2.5 with x0, x1 integer in [0, 3], whose optimal integer
+  // values are (1, 2) with x2 = 0.5
+  HighsModel model;
+  model.lp_.num_col_ = 3;
+  model.lp_.num_row_ = 1;
+  model.lp_.offset_ = 0.16 + 2.56;
+  model.lp_.col_cost_ = {-0.8, -3.2, -1};
+  model.lp_.col_lower_ = {0, 0, -inf};
+  model.lp_.col_upper_ = {3, 3, inf};
+  model.lp_.row_lower_ = {2.5};
+  model.lp_.row_upper_ = {inf};
+  model.lp_.a_matrix_.format_ = MatrixFormat::kRowwise;
+  model.lp_.a_matrix_.start_ = {0, 2};
+  model.lp_.a_matrix_.index_ = {0, 1};
+  model.lp_.a_matrix_.value_ = {1, 1};
+  model.lp_.integrality_ = {HighsVarType::kInteger, HighsVarType::kInteger,
+                            HighsVarType::kContinuous};
+  model.hessian_.dim_ = 3;
+  model.hessian_.start_ = {0, 1, 2, 3};
+  model.hessian_.index_ = {0, 1, 2};
+  model.hessian_.value_ = {2, 2, 2};
+  const double required_objective_value = 0.36 + 0.16 - 0.25;
+
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("miqp_branch_and_bound", true);
+  const HighsInfo& info = highs.getInfo();
+  const HighsSolution& solution = highs.getSolution();
+  for (HighsInt k = 0; k < 2; k++) {
+    if (k == 1) {
+      // Negate the objective and maximize
+      model.lp_.offset_ = -model.lp_.offset_;
+      for (double& cost : model.lp_.col_cost_) cost = -cost;
+      for (double& value : model.hessian_.value_) value = -value;
+      model.lp_.sense_ = ObjSense::kMaximize;
+    }
+    REQUIRE(highs.passModel(model) == HighsStatus::kOk);
+    REQUIRE(highs.run() == HighsStatus::kOk);
+    REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+    REQUIRE(info.mip_node_count > 1);
+    REQUIRE(fabs(info.objective_function_value -
+                 (k == 0 ? 1 : -1) * required_objective_value) <
+            double_equal_tolerance);
+    REQUIRE(fabs(solution.col_value[0] - 1) < double_equal_tolerance);
+    REQUIRE(fabs(solution.col_value[1] - 2) < double_equal_tolerance);
+    REQUIRE(fabs(solution.col_value[2] - 0.5) < double_equal_tolerance);
+  }
+
+  // Without an integer feasible point, the MIQP is infeasible, although
+  // its QP relaxation is feasible
+  REQUIRE(highs.changeRowBounds(0, 2.2, 2.8) == HighsStatus::kOk);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kInfeasible);
+}
+
+TEST_CASE("test-miqp-hot-start", "[qpsolver]") {
+  // min sum_i (x_i - c_i)^2 subject to sum_i x_i <= 100 with x integer
+  // in [0, 5]. Moving a branching column of the parent's solution onto
+  // its new bound leaves the solution feasible, so the QP relaxation
+  // of each node is hot started and needs few iterations
+  const HighsInt num_col = 10;
+  HighsModel model;
+  model.lp_.num_col_ = num_col;
+  model.lp_.num_row_ = 1;
+  model.lp_.row_lower_ = {-inf};
+  model.lp_.row_upper_ = {100};
+  model.lp_.a_matrix_.format_ = MatrixFormat::kRowwise;
+  model.lp_.a_matrix_.start_ = {0, num_col};
+  model.hessian_.dim_ = num_col;
+  model.hessian_.start_.assign(1, 0);
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    const double target = 0.3 + 0.37 * iCol;
+    model.lp_.offset_ += target * target;
+    model.lp_.col_cost_.push_back(-2 * target);
+    model.lp_.col_lower_.push_back(0);
+    model.lp_.col_upper_.push_back(5);
+    model.lp_.integrality_.push_back(HighsVarType::kInteger);
+    model.lp_.a_matrix_.index_.push_back(iCol);
+    model.lp_.a_matrix_.value_.push_back(1);
+    model.hessian_.index_.push_back(iCol);
+    model.hessian_.value_.push_back(2);
+    model.hessian_.start_.push_back(iCol + 1);
+  }
+
+  Highs highs;
+  highs.setOptionValue("output_flag", dev_run);
+  highs.setOptionValue("miqp_branch_and_bound", true);
+  const HighsInfo& info = highs.getInfo();
+  REQUIRE(highs.passModel(model) == HighsStatus::kOk);
+  highs.setOptionValue("solve_relaxation", true);
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  const HighsInt root_qp_iteration_count = info.qp_iteration_count;
+  REQUIRE(root_qp_iteration_count > 0);
+
+  highs.setOptionValue("solve_relaxation", false);
+  highs.clearSolver();
+  REQUIRE(highs.run() == HighsStatus::kOk);
+  REQUIRE(highs.getModelStatus() == HighsModelStatus::kOptimal);
+  REQUIRE(info.mip_node_count > 1);
+  if (dev_run)
+    printf("MIQP has %d nodes and %d QP iterations, the root %d\n",
+           int(info.mip_node_count), int(info.qp_iteration_count),
+           int(root_qp_iteration_count));
+  // Started from scratch, each node needs about as many iterations as
+  // the root
+  REQUIRE(4 * info.qp_iteration_count <
+          info.mip_node_count * root_qp_iteration_count);
+}
+
+typedef std::vector<std::vector<double>> DenseFactor;
+
+// Applies the operations on the sparse rows of a CholeskyFactor, and
+// compares the rows with a dense factor
+class CholeskyFactorTest {
+ public:
+  static void set(CholeskyFactor& factor, const DenseFactor& dense) {
+    const HighsInt dim = dense.size();
+    factor.L.assign(dim, CholeskyFactor::SparseRow());
+    for (HighsInt i = 0; i < dim; i++)
+      for (HighsInt j = 0; j < dim; j++)
+        if (dense[i][j] != 0.0 || j == i) factor.L[i].push(j, dense[i][j]);
+    factor.current_k = dim;
+    factor.uptodate = true;
+  }
+
+  static bool equal(const CholeskyFactor& factor, const DenseFactor& dense) {
+    const HighsInt dim = dense.size();
+    if (factor.current_k != dim || (HighsInt)factor.L.size() != dim)
+      return false;
+    for (HighsInt i = 0; i < dim; i++) {
+      // the entries of a row are sorted and include its diagonal, which
+      // is the first entry unless the row is a spike being eliminated
+      const std::vector<HighsInt>& index = factor.L[i].index;
+      if (!std::binary_search(index.begin(), index.end(), i)) return false;
+      if (index.back() >= dim) return false;
+      for (size_t k = 1; k < index.size(); k++)
+        if (index[k] <= index[k - 1]) return false;
+      for (HighsInt j = 0; j < dim; j++)
+        if (fabs(factor.entry(i, j) - dense[i][j]) > 1e-10) return false;
+    }
+    return true;
+  }
+
+  static void addRow(CholeskyFactor& factor, HighsInt target, double alpha,
+                     HighsInt src, HighsInt mincol) {
+    factor.addRow(target, alpha, factor.L[src], mincol);
+  }
+
+  static void rotateRows(CholeskyFactor& factor, HighsInt i, HighsInt j,
+                         double cos_, double sin_, HighsInt col) {
+    factor.rotateRows(i, j, cos_, sin_, col);
+  }
+
+  static void eliminate(CholeskyFactor& factor, HighsInt i, HighsInt j) {
+    factor.eliminate(i, j, factor.entry(i, i), factor.entry(j, i));
+  }
+
+  static void removeLast(CholeskyFactor& factor) { factor.removeLast(); }
+};
+
+// A random upper triangular factor with a positive diagonal
+static DenseFactor randomFactor(HighsRandom& random, const HighsInt dim) {
+  DenseFactor dense(dim, std::vector<double>(dim, 0.0));
+  for (HighsInt i = 0; i < dim; i++) {
+    dense[i][i] = random.real(1, 2);
+    for (HighsInt j = i + 1; j < dim; j++)
+      if (random.fraction() < 0.3) dense[i][j] = random.real(-1, 1);
+  }
+  return dense;
+}
+
+static void denseRotateRows(DenseFactor& dense, HighsInt i, HighsInt j,
+                            double cos_, double sin_, HighsInt col) {
+  for (size_t k = 0; k < dense.size(); k++) {
+    const double a_ik = dense[i][k];
+    const double a_jk = dense[j][k];
+    dense[i][k] = cos_ * a_ik - sin_ * a_jk;
+    dense[j][k] = sin_ * a_ik + cos_ * a_jk;
+  }
+  dense[j][col] = 0.0;
+}
+
+static void denseEliminate(DenseFactor& dense, HighsInt i, HighsInt j) {
+  if (dense[j][i] == 0.0) return;
+  const double z = sqrt(dense[i][i] * dense[i][i] + dense[j][i] * dense[j][i]);
+  denseRotateRows(dense, i, j, dense[i][i] / z, -dense[j][i] / z, i);
+}
+
+static void denseRemoveLast(DenseFactor& dense) {
+  dense.pop_back();
+  for (std::vector<double>& row : dense) row.pop_back();
+}
+
+static void denseReduce(DenseFactor& dense, const QpVector& d,
+                        HighsInt maxabsd, bool p_in_v) {
+  const HighsInt k = dense.size();
+  const HighsInt p = maxabsd;
+  // move row and column p to the bottom and right
+  std::rotate(dense.begin() + p, dense.begin() + p + 1, dense.end());
+  for (std::vector<double>& row : dense)
+    std::rotate(row.begin() + p, row.begin() + p + 1, row.end());
+  if (k == 1) {
+    denseRemoveLast(dense);
+    return;
+  }
+  if (!p_in_v) {
+    for (HighsInt r = p - 1; r >= 0; r--) denseEliminate(dense, k - 1, r);
+    const double lastdiag = dense[k - 1][k - 1];
+    for (HighsInt i = 0; i < d.num_nz; i++) {
+      const HighsInt idx = d.index[i];
+      if (idx == maxabsd) continue;
+      const HighsInt col = idx < maxabsd ? idx : idx - 1;
+      dense[k - 1][col] += -d.value[idx] / d.value[maxabsd] * lastdiag;
+    }
+  }
+  for (HighsInt i = 0; i < k - 1; i++) denseEliminate(dense, i, k - 1);
+  denseRemoveLast(dense);
+}
+
+TEST_CASE("test-qp-factor-operations", "[qpsolver]") {
+  // The factor isn't recomputed, so the instance and the basis are only
+  // needed to construct it
+  const HighsInt dim = 12;
+  Instance instance(dim, 0);
+  instance.A.mat.start.assign(dim + 1, 0);
+  Statistics statistics;
+  Runtime runtime(instance, statistics);
+  std::vector<HighsInt> inactive;
+  for (HighsInt i = 0; i < dim; i++) inactive.push_back(i);
+  Basis basis(runtime, {}, {}, inactive);
+  CholeskyFactor factor(runtime, basis);
+  HighsRandom random(7);
+
+  // addRow, as in the right looking factorization
+  DenseFactor dense = randomFactor(random, dim);
+  CholeskyFactorTest::set(factor, dense);
+  REQUIRE(CholeskyFactorTest::equal(factor, dense));
+  for (HighsInt src = 0; src < dim - 1; src++) {
+    const HighsInt target = random.integer(src + 1, dim);
+    const double alpha = random.real(-1, 1);
+    CholeskyFactorTest::addRow(factor, target, alpha, src, target);
+    for (HighsInt col = target; col < dim; col++)
+      dense[target][col] += alpha * dense[src][col];
+    REQUIRE(CholeskyFactorTest::equal(factor, dense));
+  }
+
+  // rotateRows with a spike in the last row whose first entry is in
+  // column i, by any angle
+  for (HighsInt i = 0; i < dim - 1; i++) {
+    dense = randomFactor(random, dim);
+    for (HighsInt col = i; col < dim - 1; col++)
+      if (col == i || random.fraction() < 0.5)
+        dense[dim - 1][col] = random.real(-1, 1);
+    CholeskyFactorTest::set(factor, dense);
+    const double angle = random.real(0, 2 * M_PI);
+    CholeskyFactorTest::rotateRows(factor, i, dim - 1, cos(angle), sin(angle),
+                                   i);
+    denseRotateRows(dense, i, dim - 1, cos(angle), sin(angle), i);
+    REQUIRE(CholeskyFactorTest::equal(factor, dense));
+  }
+
+  // eliminate a spike in the last row, as in reduce
+  dense = randomFactor(random, dim);
+  for (HighsInt col = 0; col < dim - 1; col++)
+    if (random.fraction() < 0.5) dense[dim - 1][col] = random.real(-1, 1);
+  CholeskyFactorTest::set(factor, dense);
+  for (HighsInt i = 0; i < dim - 1; i++) {
+    if (dense[dim - 1][i] == 0.0) continue;
+    CholeskyFactorTest::eliminate(factor, i, dim - 1);
+    denseEliminate(dense, i, dim - 1);
+  }
+  REQUIRE(CholeskyFactorTest::equal(factor, dense));
+
+  // removeLast
+  dense = randomFactor(random, dim);
+  CholeskyFactorTest::set(factor, dense);
+  for (HighsInt k = dim; k > 0; k--) {
+    CholeskyFactorTest::removeLast(factor);
+    denseRemoveLast(dense);
+    REQUIRE(CholeskyFactorTest::equal(factor, dense));
+  }
+}
+
+TEST_CASE("test-qp-factor-reduce", "[qpsolver]") {
+  const HighsInt dim = 12;
+  Instance instance(dim, 0);
+  instance.A.mat.start.assign(dim + 1, 0);
+  Statistics statistics;
+  Runtime runtime(instance, statistics);
+  std::vector<HighsInt> inactive;
+  for (HighsInt i = 0; i < dim; i++) inactive.push_back(i);
+  Basis basis(runtime, {}, {}, inactive);
+  CholeskyFactor factor(runtime, basis);
+  HighsRandom random(11);
+
+  for (HighsInt p_in_v = 0; p_in_v < 2; p_in_v++) {
+    for (HighsInt p = 0; p < dim; p++) {
+      DenseFactor dense = randomFactor(random, dim);
+      CholeskyFactorTest::set(factor, dense);
+      // reduce the factor one column at a time, down to a single column
+      for (HighsInt k = dim; k > 0; k--) {
+        const HighsInt maxabsd = std::min(p, k - 1);
+        QpVector d(k);
+        for (HighsInt i = 0; i < k; i++)
+          if (i == maxabsd || random.fraction() < 0.4)
+            d.value[i] = i == maxabsd ? 2.0 : random.real(-1, 1);
+        d.resparsify();
+        factor.reduce(d, maxabsd, p_in_v);
+        denseReduce(dense, d, maxabsd, p_in_v);
+        REQUIRE(CholeskyFactorTest::equal(factor, dense));
+      }
+    }
+  }
+}
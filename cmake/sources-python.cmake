@@ -174,9 +174,11 @@ set(highs_sources_python
     src/interfaces/highs_c_api.cpp
     src/io/Filereader.cpp
     src/io/FilereaderEms.cpp
+    src/io/FilereaderHbm.cpp
     src/io/FilereaderLp.cpp
     src/io/FilereaderMps.cpp
     src/io/HighsIO.cpp
+    src/io/HighsTextWriter.cpp
     src/io/HMpsFF.cpp
     src/io/HMPSIO.cpp
     src/io/LoadOptions.cpp
@@ -209,6 +211,9 @@ set(highs_sources_python
     src/mip/HighsLpRelaxation.cpp
     src/mip/HighsMipSolver.cpp
     src/mip/HighsMipSolverData.cpp
+    src/mip/HighsMiqpSolver.cpp
+    src/mip/HighsMipCheckpoint.cpp
+    src/mip/HighsMipSolutionWriter.cpp
     src/mip/HighsModkSeparator.cpp
     src/mip/HighsNodeQueue.cpp
     src/mip/HighsObjectiveFunction.cpp
@@ -285,9 +290,11 @@ set(highs_headers_python
     src/interfaces/highs_c_api.h
     src/io/Filereader.h
     src/io/FilereaderEms.h
+    src/io/FilereaderHbm.h
     src/io/FilereaderLp.h
     src/io/FilereaderMps.h
     src/io/HighsIO.h
+    src/io/HighsTextWriter.h
     src/io/HMpsFF.h
     src/io/HMPSIO.h
     src/io/LoadOptions.h
@@ -326,6 +333,9 @@ set(highs_headers_python
     src/mip/HighsLpRelaxation.h
     src/mip/HighsMipSolver.h
     src/mip/HighsMipSolverData.h
+    src/mip/HighsMiqpSolver.h
+    src/mip/HighsMipCheckpoint.h
+    src/mip/HighsMipSolutionWriter.h
     src/mip/HighsModkSeparator.h
     src/mip/HighsNodeQueue.h
     src/mip/HighsObjectiveFunction.h
@@ -419,6 +429,7 @@ set(highs_headers_python
     src/util/HighsMatrixSlice.h
     src/util/HighsMatrixUtils.h
     src/util/HighsMemoryAllocation.h
+    src/util/HighsNameTable.h
     src/util/HighsRandom.h
     src/util/HighsRbTree.h
     src/util/HighsSort.h
@@ -174,9 +174,11 @@ set(highs_sources
     interfaces/highs_c_api.cpp
     io/Filereader.cpp
     io/FilereaderEms.cpp
+    io/FilereaderHbm.cpp
     io/FilereaderLp.cpp
     io/FilereaderMps.cpp
     io/HighsIO.cpp
+    io/HighsTextWriter.cpp
     io/HMpsFF.cpp
     io/HMPSIO.cpp
     io/LoadOptions.cpp
@@ -210,6 +212,9 @@ set(highs_sources
     mip/HighsLpRelaxation.cpp
     mip/HighsMipSolver.cpp
     mip/HighsMipSolverData.cpp
+    mip/HighsMiqpSolver.cpp
+    mip/HighsMipCheckpoint.cpp
+    mip/HighsMipSolutionWriter.cpp
     mip/HighsModkSeparator.cpp
     mip/HighsNodeQueue.cpp
     mip/HighsObjectiveFunction.cpp
@@ -289,9 +294,11 @@ set(highs_headers
     interfaces/highs_c_api.h
     io/Filereader.h
     io/FilereaderEms.h
+    io/FilereaderHbm.h
     io/FilereaderLp.h
     io/FilereaderMps.h
     io/HighsIO.h
+    io/HighsTextWriter.h
     io/HMpsFF.h
     io/HMPSIO.h
     io/LoadOptions.h
@@ -330,6 +337,9 @@ set(highs_headers
     mip/HighsLpRelaxation.h
     mip/HighsMipSolver.h
     mip/HighsMipSolverData.h
+    mip/HighsMiqpSolver.h
+    mip/HighsMipCheckpoint.h
+    mip/HighsMipSolutionWriter.h
     mip/HighsModkSeparator.h
     mip/HighsNodeQueue.h
     mip/HighsObjectiveFunction.h
@@ -423,6 +433,7 @@ set(highs_headers
     util/HighsMatrixSlice.h
     util/HighsMatrixUtils.h
     util/HighsMemoryAllocation.h
+    util/HighsNameTable.h
     util/HighsRandom.h
     util/HighsRbTree.h
     util/HighsSort.h
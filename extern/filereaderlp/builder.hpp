@@ -1,24 +1,78 @@
 #ifndef __READERLP_BUILDER_HPP__
 #define __READERLP_BUILDER_HPP__
 
-#include <memory>
+#include <cstring>
+#include <deque>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "model.hpp"
 
+// the characters of a name stored elsewhere
+struct NameView {
+  const char* data;
+  size_t size;
+
+  bool operator==(const NameView& other) const {
+    return size == other.size && std::memcmp(data, other.data, size) == 0;
+  }
+};
+
+struct NameViewHash {
+  size_t operator()(const NameView& name) const {
+    // FNV-1a
+    size_t hash = 2166136261u;
+    for (size_t i = 0; i < name.size; i++)
+      hash = (hash ^ (unsigned char)name.data[i]) * 16777619u;
+    return hash;
+  }
+};
+
 struct Builder {
-  std::unordered_map<std::string, std::shared_ptr<Variable>> variables;
+  // Each distinct identifier in the file is stored once, and tokens
+  // refer to it by its index in names. A deque doesn't move its
+  // elements as names are added, so nameindex is keyed on views of
+  // them rather than on copies. The variables take their names when
+  // the names are cleared
+  std::deque<std::string> names;
+  std::unordered_map<NameView, unsigned int, NameViewHash> nameindex;
+  // index of the variable with each name, or -1 if the name has not
+  // (yet) been used for a variable
+  std::vector<int> varindex;
 
   Model model;
 
-  std::shared_ptr<Variable> getvarbyname(const std::string& name) {
-    auto it = variables.find(name);
-    if (it != variables.end()) return it->second;
-    auto newvar = std::shared_ptr<Variable>(new Variable(name));
-    variables.insert(std::make_pair(name, newvar));
-    model.variables.push_back(newvar);
-    return newvar;
+  unsigned int internname(const std::string& name) {
+    auto it = nameindex.find(NameView{name.data(), name.size()});
+    if (it != nameindex.end()) return it->second;
+    unsigned int id = names.size();
+    names.push_back(name);
+    varindex.push_back(-1);
+    nameindex.insert(
+        std::make_pair(NameView{names.back().data(), names.back().size()}, id));
+    return id;
+  }
+
+  unsigned int getvarbyname(unsigned int id) {
+    if (varindex[id] < 0) {
+      varindex[id] = model.variables.size();
+      model.variables.push_back(Variable());
+    }
+    return varindex[id];
+  }
+
+  Variable& getvar(unsigned int id) {
+    return model.variables[getvarbyname(id)];
+  }
+
+  void clearnames() {
+    std::unordered_map<NameView, unsigned int, NameViewHash>().swap(nameindex);
+    for (size_t id = 0; id < names.size(); id++)
+      if (varindex[id] >= 0)
+        model.variables[varindex[id]].name = std::move(names[id]);
+    std::deque<std::string>().swap(names);
+    std::vector<int>().swap(varindex);
   }
 };
 
@@ -1,9 +1,10 @@
 #ifndef __READERLP_MODEL_HPP__
 #define __READERLP_MODEL_HPP__
 
+#include <cstddef>
 #include <limits>
-#include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 enum class VariableType {
@@ -25,44 +26,57 @@ struct Variable {
   Variable(std::string n = "") : name(n){};
 };
 
+// terms refer to variables by their index in Model::variables
 struct LinTerm {
-  std::shared_ptr<Variable> var;
-  double coef = 1.0;
+  unsigned int var;
+  double coef;
 };
 
 struct QuadTerm {
-  std::shared_ptr<Variable> var1;
-  std::shared_ptr<Variable> var2;
-  double coef = 1.0;
+  unsigned int var1;
+  unsigned int var2;
+  double coef;
 };
 
 struct Expression {
-  std::vector<std::shared_ptr<LinTerm>> linterms;
-  std::vector<std::shared_ptr<QuadTerm>> quadterms;
+  std::vector<LinTerm> linterms;
+  std::vector<QuadTerm> quadterms;
   double offset = 0.0;
   std::string name = "";
+
+  void clear() {
+    linterms.clear();
+    quadterms.clear();
+    offset = 0.0;
+    name.clear();
+  }
 };
 
 struct Constraint {
   double lowerbound = -std::numeric_limits<double>::infinity();
   double upperbound = std::numeric_limits<double>::infinity();
-  std::shared_ptr<Expression> expr;
-
-  Constraint() : expr(std::shared_ptr<Expression>(new Expression)){};
+  std::string name;
+  // number of quadratic terms, which HiGHS cannot handle
+  size_t numquadterms = 0;
 };
 
 struct SOS {
   std::string name = "";
   short type = 0;  // 1 or 2
-  std::vector<std::pair<std::shared_ptr<Variable>, double>> entries;
+  std::vector<std::pair<unsigned int, double>> entries;
 };
 
 struct Model {
-  std::shared_ptr<Expression> objective;
-  ObjectiveSense sense;
-  std::vector<std::shared_ptr<Constraint>> constraints;
-  std::vector<std::shared_ptr<Variable>> variables;
-  std::vector<std::shared_ptr<SOS>> soss;
+  Expression objective;
+  ObjectiveSense sense = ObjectiveSense::MIN;
+  std::vector<Constraint> constraints;
+  // the linear terms of the constraints, stored row-wise: those of
+  // constraint i are constraintterms[constraintstart[i]] up to
+  // constraintterms[constraintstart[i + 1]]
+  std::vector<size_t> constraintstart;
+  std::vector<LinTerm> constraintterms;
+  std::vector<Variable> variables;
+  std::vector<SOS> soss;
 };
 
 #endif
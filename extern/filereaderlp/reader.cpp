@@ -11,6 +11,7 @@
 #include <map>
 #include <memory>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include "HConfig.h"  // for ZLIB_FOUND
@@ -20,22 +21,6 @@
 #include "../extern/zstr/zstr.hpp"
 #endif
 
-// Cygwin doesn't come with an implementation for strdup if compiled with
-// std=cxx
-#ifdef __CYGWIN__
-#include <cstdlib>
-char* strdup(const char* s) {
-  size_t slen = strlen(s);
-  char* result = (char*)malloc(slen + 1);
-  if (result == NULL) {
-    return NULL;
-  }
-
-  memcpy(result, s, slen + 1);
-  return result;
-}
-#endif
-
 enum class RawTokenType {
   NONE,
   STR,
@@ -144,35 +129,12 @@ struct ProcessedToken {
   union {
     LpSectionKeyword keyword;
     SosType sostype;
-    char* name;
+    // index of the identifier in Builder::names
+    unsigned int name;
     double value;
     LpComparisonType dir;
   };
 
-  ProcessedToken(const ProcessedToken&) = delete;
-  ProcessedToken(ProcessedToken&& t) : type(t.type) {
-    switch (type) {
-      case ProcessedTokenType::SECID:
-        keyword = t.keyword;
-        break;
-      case ProcessedTokenType::SOSTYPE:
-        sostype = t.sostype;
-        break;
-      case ProcessedTokenType::CONID:
-      case ProcessedTokenType::VARID:
-        name = t.name;
-        break;
-      case ProcessedTokenType::CONST:
-        value = t.value;
-        break;
-      case ProcessedTokenType::COMP:
-        dir = t.dir;
-        break;
-      default:;
-    }
-    t.type = ProcessedTokenType::NONE;
-  }
-
   ProcessedToken(ProcessedTokenType t) : type(t){};
 
   ProcessedToken(LpSectionKeyword kw)
@@ -181,24 +143,14 @@ struct ProcessedToken {
   ProcessedToken(SosType sos)
       : type(ProcessedTokenType::SOSTYPE), sostype(sos){};
 
-  ProcessedToken(ProcessedTokenType t, const std::string& s) : type(t) {
+  ProcessedToken(ProcessedTokenType t, unsigned int id) : type(t), name(id) {
     assert(t == ProcessedTokenType::CONID || t == ProcessedTokenType::VARID);
-#ifndef _WIN32
-    name = strdup(s.c_str());
-#else
-    name = _strdup(s.c_str());
-#endif
   };
 
   ProcessedToken(double v) : type(ProcessedTokenType::CONST), value(v){};
 
   ProcessedToken(LpComparisonType comp)
       : type(ProcessedTokenType::COMP), dir(comp){};
-
-  ~ProcessedToken() {
-    if (type == ProcessedTokenType::CONID || type == ProcessedTokenType::VARID)
-      free(name);
-  }
 };
 
 // how many raw tokens to cache
@@ -241,7 +193,7 @@ class Reader {
   void processendsec();
   void parseexpression(std::vector<ProcessedToken>::iterator& it,
                        std::vector<ProcessedToken>::iterator end,
-                       std::shared_ptr<Expression> expr, bool isobj);
+                       Expression& expr, bool isobj);
 
  public:
   Reader(std::string filename) {
@@ -325,11 +277,13 @@ Model Reader::read() {
     sectiontokens.count(LpSectionKeyword::OBJMAX);
   lpassert(num_objective_section>0);
 
+  builder.model.constraintstart.assign(1, 0);
   processsections();
   processedtokens.clear();
   processedtokens.shrink_to_fit();
+  builder.clearnames();
 
-  return builder.model;
+  return std::move(builder.model);
 }
 
 void Reader::processnonesec() {
@@ -338,9 +292,9 @@ void Reader::processnonesec() {
 
 void Reader::parseexpression(std::vector<ProcessedToken>::iterator& it,
                              std::vector<ProcessedToken>::iterator end,
-                             std::shared_ptr<Expression> expr, bool isobj) {
+                             Expression& expr, bool isobj) {
   if (it != end && it->type == ProcessedTokenType::CONID) {
-    expr->name = it->name;
+    expr.name = builder.names[it->name];
     ++it;
   }
 
@@ -350,15 +304,7 @@ void Reader::parseexpression(std::vector<ProcessedToken>::iterator& it,
     // const var
     if (next != end && it->type == ProcessedTokenType::CONST &&
         next->type == ProcessedTokenType::VARID) {
-      std::string name = next->name;
-
-      std::shared_ptr<LinTerm> linterm =
-          std::shared_ptr<LinTerm>(new LinTerm());
-      linterm->coef = it->value;
-      linterm->var = builder.getvarbyname(name);
-      //	 printf("LpReader: Term   %+g %s\n", linterm->coef,
-      //name.c_str());
-      expr->linterms.push_back(linterm);
+      expr.linterms.push_back({builder.getvarbyname(next->name), it->value});
 
       ++it;
       ++it;
@@ -367,23 +313,15 @@ void Reader::parseexpression(std::vector<ProcessedToken>::iterator& it,
 
     // const
     if (it->type == ProcessedTokenType::CONST) {
-      //      printf("LpReader: Offset change from %+g by %+g\n", expr->offset, it->value);
-      expr->offset += it->value;
+      //      printf("LpReader: Offset change from %+g by %+g\n", expr.offset, it->value);
+      expr.offset += it->value;
       ++it;
       continue;
     }
 
     // var
     if (it->type == ProcessedTokenType::VARID) {
-      std::string name = it->name;
-
-      std::shared_ptr<LinTerm> linterm =
-          std::shared_ptr<LinTerm>(new LinTerm());
-      linterm->coef = 1.0;
-      linterm->var = builder.getvarbyname(name);
-      //	 printf("LpReader: Term   %+g %s\n", linterm->coef,
-      //name.c_str());
-      expr->linterms.push_back(linterm);
+      expr.linterms.push_back({builder.getvarbyname(it->name), 1.0});
 
       ++it;
       continue;
@@ -410,16 +348,10 @@ void Reader::parseexpression(std::vector<ProcessedToken>::iterator& it,
             next1->type == ProcessedTokenType::VARID &&
             next2->type == ProcessedTokenType::HAT &&
             next3->type == ProcessedTokenType::CONST) {
-          std::string name = next1->name;
-
           lpassert(next3->value == 2.0);
 
-          std::shared_ptr<QuadTerm> quadterm =
-              std::shared_ptr<QuadTerm>(new QuadTerm());
-          quadterm->coef = it->value;
-          quadterm->var1 = builder.getvarbyname(name);
-          quadterm->var2 = builder.getvarbyname(name);
-          expr->quadterms.push_back(quadterm);
+          unsigned int var = builder.getvarbyname(next1->name);
+          expr.quadterms.push_back({var, var, it->value});
 
           it = ++next3;
           continue;
@@ -429,16 +361,10 @@ void Reader::parseexpression(std::vector<ProcessedToken>::iterator& it,
         if (next2 != end && it->type == ProcessedTokenType::VARID &&
             next1->type == ProcessedTokenType::HAT &&
             next2->type == ProcessedTokenType::CONST) {
-          std::string name = it->name;
-
           lpassert(next2->value == 2.0);
 
-          std::shared_ptr<QuadTerm> quadterm =
-              std::shared_ptr<QuadTerm>(new QuadTerm());
-          quadterm->coef = 1.0;
-          quadterm->var1 = builder.getvarbyname(name);
-          quadterm->var2 = builder.getvarbyname(name);
-          expr->quadterms.push_back(quadterm);
+          unsigned int var = builder.getvarbyname(it->name);
+          expr.quadterms.push_back({var, var, 1.0});
 
           it = next3;
           continue;
@@ -449,15 +375,9 @@ void Reader::parseexpression(std::vector<ProcessedToken>::iterator& it,
             next1->type == ProcessedTokenType::VARID &&
             next2->type == ProcessedTokenType::ASTERISK &&
             next3->type == ProcessedTokenType::VARID) {
-          std::string name1 = next1->name;
-          std::string name2 = next3->name;
-
-          std::shared_ptr<QuadTerm> quadterm =
-              std::shared_ptr<QuadTerm>(new QuadTerm());
-          quadterm->coef = it->value;
-          quadterm->var1 = builder.getvarbyname(name1);
-          quadterm->var2 = builder.getvarbyname(name2);
-          expr->quadterms.push_back(quadterm);
+          unsigned int var1 = builder.getvarbyname(next1->name);
+          unsigned int var2 = builder.getvarbyname(next3->name);
+          expr.quadterms.push_back({var1, var2, it->value});
 
           it = ++next3;
           continue;
@@ -467,15 +387,9 @@ void Reader::parseexpression(std::vector<ProcessedToken>::iterator& it,
         if (next2 != end && it->type == ProcessedTokenType::VARID &&
             next1->type == ProcessedTokenType::ASTERISK &&
             next2->type == ProcessedTokenType::VARID) {
-          std::string name1 = it->name;
-          std::string name2 = next2->name;
-
-          std::shared_ptr<QuadTerm> quadterm =
-              std::shared_ptr<QuadTerm>(new QuadTerm());
-          quadterm->coef = 1.0;
-          quadterm->var1 = builder.getvarbyname(name1);
-          quadterm->var2 = builder.getvarbyname(name2);
-          expr->quadterms.push_back(quadterm);
+          unsigned int var1 = builder.getvarbyname(it->name);
+          unsigned int var2 = builder.getvarbyname(next2->name);
+          expr.quadterms.push_back({var1, var2, 1.0});
 
           it = next3;
           continue;
@@ -510,7 +424,6 @@ void Reader::parseexpression(std::vector<ProcessedToken>::iterator& it,
 }
 
 void Reader::processobjsec() {
-  builder.model.objective = std::shared_ptr<Expression>(new Expression);
   if (sectiontokens.count(LpSectionKeyword::OBJMIN)) {
     builder.model.sense = ObjectiveSense::MIN;
     parseexpression(sectiontokens[LpSectionKeyword::OBJMIN].first,
@@ -536,10 +449,15 @@ void Reader::processconsec() {
       sectiontokens[LpSectionKeyword::CON].first);
   std::vector<ProcessedToken>::iterator& end(
       sectiontokens[LpSectionKeyword::CON].second);
+  // each constraint is parsed into the same expression, whose linear
+  // terms are then appended to the row-wise constraint matrix
+  Expression expr;
   while (begin != end) {
-    std::shared_ptr<Constraint> con =
-        std::shared_ptr<Constraint>(new Constraint);
-    parseexpression(begin, end, con->expr, false);
+    Constraint con;
+    expr.clear();
+    parseexpression(begin, end, expr, false);
+    con.name = expr.name;
+    con.numquadterms = expr.quadterms.size();
     // should not be at end of section yet, but a comparison operator should be
     // next
     lpassert(begin != sectiontokens[LpSectionKeyword::CON].second);
@@ -553,18 +471,23 @@ void Reader::processconsec() {
     lpassert(begin->type == ProcessedTokenType::CONST);
     switch (dir) {
       case LpComparisonType::EQ:
-        con->lowerbound = con->upperbound = begin->value;
+        con.lowerbound = con.upperbound = begin->value;
         break;
       case LpComparisonType::LEQ:
-        con->upperbound = begin->value;
+        con.upperbound = begin->value;
         break;
       case LpComparisonType::GEQ:
-        con->lowerbound = begin->value;
+        con.lowerbound = begin->value;
         break;
       default:
         lpassert(false);
     }
-    builder.model.constraints.push_back(con);
+    builder.model.constraints.push_back(std::move(con));
+    builder.model.constraintterms.insert(builder.model.constraintterms.end(),
+                                         expr.linterms.begin(),
+                                         expr.linterms.end());
+    builder.model.constraintstart.push_back(
+        builder.model.constraintterms.size());
     ++begin;
   }
 }
@@ -582,10 +505,9 @@ void Reader::processboundssec() {
     // VAR free
     if (next1 != end && begin->type == ProcessedTokenType::VARID &&
         next1->type == ProcessedTokenType::FREE) {
-      std::string name = begin->name;
-      std::shared_ptr<Variable> var = builder.getvarbyname(name);
-      var->lowerbound = -kHighsInf;
-      var->upperbound = kHighsInf;
+      Variable& var = builder.getvar(begin->name);
+      var.lowerbound = -kHighsInf;
+      var.upperbound = kHighsInf;
       begin = ++next1;
       continue;
     }
@@ -619,11 +541,10 @@ void Reader::processboundssec() {
       double lb = begin->value;
       double ub = next4->value;
 
-      std::string name = next2->name;
-      std::shared_ptr<Variable> var = builder.getvarbyname(name);
+      Variable& var = builder.getvar(next2->name);
 
-      var->lowerbound = lb;
-      var->upperbound = ub;
+      var.lowerbound = lb;
+      var.upperbound = ub;
 
       begin = ++next4;
       continue;
@@ -634,21 +555,20 @@ void Reader::processboundssec() {
         next1->type == ProcessedTokenType::COMP &&
         next2->type == ProcessedTokenType::VARID) {
       double value = begin->value;
-      std::string name = next2->name;
-      std::shared_ptr<Variable> var = builder.getvarbyname(name);
+      Variable& var = builder.getvar(next2->name);
       LpComparisonType dir = next1->dir;
 
       lpassert(dir != LpComparisonType::L && dir != LpComparisonType::G);
 
       switch (dir) {
         case LpComparisonType::LEQ:
-          var->lowerbound = value;
+          var.lowerbound = value;
           break;
         case LpComparisonType::GEQ:
-          var->upperbound = value;
+          var.upperbound = value;
           break;
         case LpComparisonType::EQ:
-          var->lowerbound = var->upperbound = value;
+          var.lowerbound = var.upperbound = value;
           break;
         default:
           lpassert(false);
@@ -662,21 +582,20 @@ void Reader::processboundssec() {
         next1->type == ProcessedTokenType::COMP &&
         next2->type == ProcessedTokenType::CONST) {
       double value = next2->value;
-      std::string name = begin->name;
-      std::shared_ptr<Variable> var = builder.getvarbyname(name);
+      Variable& var = builder.getvar(begin->name);
       LpComparisonType dir = next1->dir;
 
       lpassert(dir != LpComparisonType::L && dir != LpComparisonType::G);
 
       switch (dir) {
         case LpComparisonType::LEQ:
-          var->upperbound = value;
+          var.upperbound = value;
           break;
         case LpComparisonType::GEQ:
-          var->lowerbound = value;
+          var.lowerbound = value;
           break;
         case LpComparisonType::EQ:
-          var->lowerbound = var->upperbound = value;
+          var.lowerbound = var.upperbound = value;
           break;
         default:
           lpassert(false);
@@ -703,11 +622,10 @@ void Reader::processbinsec() {
       continue;
     }
     lpassert(begin->type == ProcessedTokenType::VARID);
-    std::string name = begin->name;
-    std::shared_ptr<Variable> var = builder.getvarbyname(name);
-    var->type = VariableType::BINARY;
+    Variable& var = builder.getvar(begin->name);
+    var.type = VariableType::BINARY;
     // Respect any bounds already declared
-    if (var->upperbound == kHighsInf) var->upperbound = 1.0;
+    if (var.upperbound == kHighsInf) var.upperbound = 1.0;
   }
 }
 
@@ -725,12 +643,11 @@ void Reader::processgensec() {
       continue;
     }
     lpassert(begin->type == ProcessedTokenType::VARID);
-    std::string name = begin->name;
-    std::shared_ptr<Variable> var = builder.getvarbyname(name);
-    if (var->type == VariableType::SEMICONTINUOUS) {
-      var->type = VariableType::SEMIINTEGER;
+    Variable& var = builder.getvar(begin->name);
+    if (var.type == VariableType::SEMICONTINUOUS) {
+      var.type = VariableType::SEMIINTEGER;
     } else {
-      var->type = VariableType::GENERAL;
+      var.type = VariableType::GENERAL;
     }
   }
 }
@@ -749,12 +666,11 @@ void Reader::processsemisec() {
       continue;
     }
     lpassert(begin->type == ProcessedTokenType::VARID);
-    std::string name = begin->name;
-    std::shared_ptr<Variable> var = builder.getvarbyname(name);
-    if (var->type == VariableType::GENERAL) {
-      var->type = VariableType::SEMIINTEGER;
+    Variable& var = builder.getvar(begin->name);
+    if (var.type == VariableType::GENERAL) {
+      var.type = VariableType::SEMIINTEGER;
     } else {
-      var->type = VariableType::SEMICONTINUOUS;
+      var.type = VariableType::SEMICONTINUOUS;
     }
   }
 }
@@ -767,19 +683,19 @@ void Reader::processsossec() {
   std::vector<ProcessedToken>::iterator& end(
       sectiontokens[this_section_keyword].second);
   while (begin != end) {
-    std::shared_ptr<SOS> sos = std::shared_ptr<SOS>(new SOS);
+    SOS sos;
 
     // sos1: S1 :: x1 : 1  x2 : 2  x3 : 3
 
     // name of SOS is mandatory
     lpassert(begin->type == ProcessedTokenType::CONID);
-    sos->name = begin->name;
+    sos.name = builder.names[begin->name];
     ++begin;
 
     // SOS type
     lpassert(begin != end);
     lpassert(begin->type == ProcessedTokenType::SOSTYPE);
-    sos->type = begin->sostype == SosType::SOS1 ? 1 : 2;
+    sos.type = begin->sostype == SosType::SOS1 ? 1 : 2;
     ++begin;
 
     while (begin != end) {
@@ -788,14 +704,13 @@ void Reader::processsossec() {
       // this as a CONID but in a SOS section, this is actually a variable
       // identifier
       if (begin->type != ProcessedTokenType::CONID) break;
-      std::string name = begin->name;
       std::vector<ProcessedToken>::iterator next = begin;
       ++next;
       if (next != end && next->type == ProcessedTokenType::CONST) {
-        auto var = builder.getvarbyname(name);
+        unsigned int var = builder.getvarbyname(begin->name);
         double weight = next->value;
 
-        sos->entries.push_back({var, weight});
+        sos.entries.push_back({var, weight});
 
         begin = ++next;
         continue;
@@ -804,7 +719,7 @@ void Reader::processsossec() {
       break;
     }
 
-    builder.model.soss.push_back(sos);
+    builder.model.soss.push_back(std::move(sos));
   }
 }
 
@@ -966,7 +881,7 @@ void Reader::processtokens() {
     if (rawtokens[0].istype(RawTokenType::STR) &&
         rawtokens[1].istype(RawTokenType::COLON)) {
       processedtokens.emplace_back(ProcessedTokenType::CONID,
-                                   rawtokens[0].svalue);
+                                   builder.internname(rawtokens[0].svalue));
       nextrawtoken(2);
       continue;
     }
@@ -990,7 +905,7 @@ void Reader::processtokens() {
     // assume var identifier
     if (rawtokens[0].istype(RawTokenType::STR)) {
       processedtokens.emplace_back(ProcessedTokenType::VARID,
-                                   rawtokens[0].svalue);
+                                   builder.internname(rawtokens[0].svalue));
       nextrawtoken();
       continue;
     }
@@ -1141,16 +1056,18 @@ void Reader::nextrawtoken(size_t howmany) {
   assert(howmany <= NRAWTOKEN);
   static_assert(NRAWTOKEN == 3,
                 "code below need to be adjusted if NRAWTOKEN changes");
+  // tokens are swapped rather than moved, so that the string buffers of
+  // the tokens being overwritten are reused
   switch (howmany) {
     case 1: {
-      rawtokens[0] = std::move(rawtokens[1]);
-      rawtokens[1] = std::move(rawtokens[2]);
+      std::swap(rawtokens[0], rawtokens[1]);
+      std::swap(rawtokens[1], rawtokens[2]);
       while (!readnexttoken(rawtokens[2]))
         ;
       break;
     }
     case 2: {
-      rawtokens[0] = std::move(rawtokens[2]);
+      std::swap(rawtokens[0], rawtokens[2]);
       while (!readnexttoken(rawtokens[1]))
         ;
       while (!readnexttoken(rawtokens[2]))
@@ -1170,7 +1087,7 @@ void Reader::nextrawtoken(size_t howmany) {
       size_t i = 0;
       // move tokens up
       for (; i < NRAWTOKEN - howmany; ++i)
-        rawtokens[i] = std::move(rawtokens[i + howmany]);
+        std::swap(rawtokens[i], rawtokens[i + howmany]);
       // read new tokens at end positions
       for (; i < NRAWTOKEN; ++i)
         // call readnexttoken() to overwrite current token
@@ -1308,8 +1225,9 @@ bool Reader::readnexttoken(RawToken& t) {
   if (endpos == std::string::npos)
     endpos = this->linebuffer.size();  // take complete rest of string
   if (endpos > this->linebufferpos) {
-    t = std::string(this->linebuffer, this->linebufferpos,
+    t.svalue.assign(this->linebuffer, this->linebufferpos,
                     endpos - this->linebufferpos);
+    t.type = RawTokenType::STR;
     this->linebufferpos = endpos;
     return true;
   }
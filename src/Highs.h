@@ -14,6 +14,7 @@
 #ifndef HIGHS_H_
 #define HIGHS_H_
 
+#include <memory>
 #include <sstream>
 
 #include "lp_data/HighsCallback.h"
@@ -24,6 +25,8 @@
 #include "presolve/ICrash.h"
 #include "presolve/PresolveComponent.h"
 
+struct HighsMipCheckpoint;
+
 /**
  * @brief Return the version
  */
@@ -201,6 +204,15 @@ class Highs {
   HighsStatus readSolution(const std::string& filename,
                            const HighsInt style = kSolutionStyleRaw);
 
+  /**
+   * @brief Solve the MIP, resuming the tree search from a checkpoint
+   * written by the MIP solver to the file given by the option
+   * mip_checkpoint_file. The incumbent and pseudocosts of the checkpoint
+   * are always used, and its open nodes replace the root node if the
+   * presolved model matches the one the checkpoint was written for
+   */
+  HighsStatus resumeMip(const std::string& checkpoint_file);
+
   /**
    * @brief Assess the validity, integrality and feasibility of the
    * current primal solution. Of value after calling
@@ -1140,6 +1152,12 @@ class Highs {
    */
   const HotStart& getHotStart() const { return ekk_instance_.hot_start_; }
 
+  /**
+   * @brief Get the number of times the simplex solver has factorized a
+   * basis matrix. Advanced method: for HiGHS MIP solver
+   */
+  int64_t getSimplexNumInvert() const { return ekk_instance_.num_invert_; }
+
   /**
    * @brief Set up for simplex using the supplied hot start
    * data. Advanced method: for HiGHS MIP solver
@@ -1341,6 +1359,10 @@ class Highs {
 
   HighsPresolveLog presolve_log_;
 
+  // Checkpoint of the MIP tree search to resume from, only set during
+  // Highs::resumeMip
+  std::shared_ptr<const HighsMipCheckpoint> mip_checkpoint_;
+
   HighsInt max_threads = 0;
   // This is strictly for debugging. It's used to check whether
   // returnFromRun() was called after the previous call to
@@ -1359,8 +1381,14 @@ class Highs {
   HighsStatus completeSolutionFromDiscreteAssignment();
 
   HighsStatus callSolveLp(HighsLp& lp, const string message);
+  HighsStatus callSolveLpByComponents(
+      HighsLp& lp, const HighsInt num_component,
+      const std::vector<HighsInt>& col_component,
+      const std::vector<HighsInt>& row_component);
   HighsStatus callSolveQp();
+  HighsStatus callSolveQpIpx();
   HighsStatus callSolveMip();
+  HighsStatus callSolveMiqp();
   HighsStatus callRunPostsolve(const HighsSolution& solution,
                                const HighsBasis& basis);
 
@@ -778,6 +778,7 @@ PYBIND11_MODULE(_core, m) {
       .def_readwrite("solution_file", &HighsOptions::solution_file)
       .def_readwrite("log_file", &HighsOptions::log_file)
       .def_readwrite("write_model_to_file", &HighsOptions::write_model_to_file)
+      .def_readwrite("keep_names", &HighsOptions::keep_names)
       .def_readwrite("write_solution_to_file",
                      &HighsOptions::write_solution_to_file)
       .def_readwrite("write_solution_style",
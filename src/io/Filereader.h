@@ -15,6 +15,7 @@
 #define IO_FILEREADER_H_
 
 #include "io/HighsIO.h"
+#include "lp_data/HStruct.h"
 #include "lp_data/HighsOptions.h"
 #include "model/HighsModel.h"
 
@@ -42,6 +43,13 @@ class Filereader {
   static Filereader* getFilereader(const HighsLogOptions& log_options,
                                    const std::string filename);
 
+  // File formats that can hold a basis and solution with the model
+  // return them in basis_ and solution_ when reading, and write
+  // basis_ and solution_ if they are valid
+  virtual bool holdsSolution() const { return false; }
+  HighsBasis basis_;
+  HighsSolution solution_;
+
   virtual ~Filereader(){};
 };
 #endif
@@ -0,0 +1,591 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/FilereaderHbm.cpp
+ * @brief Binary model files, with an optional basis and solution
+ */
+
+#include "io/FilereaderHbm.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <memory>
+
+#include "lp_data/HConst.h"
+#include "lp_data/HighsLpUtils.h"
+
+#ifdef ZLIB_FOUND
+#include "../extern/zstr/zstr.hpp"
+#endif
+
+namespace {
+
+const char kHbmMagic[8] = {'H', 'i', 'G', 'H', 'S', 'H', 'B', 'M'};
+const uint32_t kHbmVersion = 1;
+// Written as a native integer to identify the byte order of the file
+const uint32_t kHbmByteOrder = 0x01020304;
+
+enum HbmSection : uint32_t {
+  kHbmEnd = 0,
+  kHbmDimensions,
+  kHbmCost,
+  kHbmColBounds,
+  kHbmRowBounds,
+  kHbmMatrix,
+  kHbmIntegrality,
+  kHbmHessian,
+  kHbmNames,
+  kHbmBasis,
+  kHbmSolution
+};
+
+// 64-bit FNV-1a applied to 8-byte words, so that large arrays are
+// checksummed at close to the speed of reading them
+class HbmChecksum {
+ public:
+  void update(const char* data, size_t size) {
+    if (num_pending_) {
+      // Complete the word left over from the previous update
+      const size_t fill = std::min(size, size_t(8) - num_pending_);
+      memcpy(pending_ + num_pending_, data, fill);
+      num_pending_ += fill;
+      data += fill;
+      size -= fill;
+      if (num_pending_ < 8) return;
+      hash_ = mix(hash_, word(pending_));
+      num_pending_ = 0;
+    }
+    for (; size >= 8; size -= 8, data += 8) hash_ = mix(hash_, word(data));
+    memcpy(pending_, data, size);
+    num_pending_ = size;
+  }
+
+  uint64_t value() const {
+    if (!num_pending_) return hash_;
+    char last[8] = {0};
+    memcpy(last, pending_, num_pending_);
+    return mix(hash_, word(last) ^ num_pending_);
+  }
+
+ private:
+  uint64_t hash_ = 0xcbf29ce484222325ULL;
+  char pending_[8];
+  size_t num_pending_ = 0;
+
+  static uint64_t word(const char* data) {
+    uint64_t w;
+    memcpy(&w, data, 8);
+    return w;
+  }
+  static uint64_t mix(uint64_t hash, uint64_t w) {
+    hash = (hash ^ w) * 0x100000001b3ULL;
+    return hash ^ (hash >> 29);
+  }
+};
+
+class HbmWriter {
+ public:
+  HbmWriter(std::ostream& stream) : stream_(stream) {}
+
+  void write(const void* data, size_t size) {
+    if (!size) return;
+    stream_.write(static_cast<const char*>(data), size);
+    checksum_.update(static_cast<const char*>(data), size);
+  }
+  template <typename T>
+  void write(const T& value) {
+    write(&value, sizeof(T));
+  }
+  template <typename T>
+  void writeVector(const std::vector<T>& v) {
+    write(v.data(), v.size() * sizeof(T));
+  }
+  void writeSection(const uint32_t tag, const uint64_t size) {
+    write(tag);
+    write(size);
+  }
+  void writeEnd() {
+    write(uint32_t(kHbmEnd));
+    const uint64_t checksum = checksum_.value();
+    stream_.write(reinterpret_cast<const char*>(&checksum), sizeof(checksum));
+  }
+  bool ok() const { return bool(stream_); }
+
+ private:
+  std::ostream& stream_;
+  HbmChecksum checksum_;
+};
+
+class HbmReader {
+ public:
+  HbmReader(std::istream& stream) : stream_(stream) {}
+
+  // The width in bytes of HighsInt when the file was written
+  uint8_t int_width = sizeof(HighsInt);
+
+  bool read(void* data, size_t size) {
+    if (!size) return true;
+    stream_.read(static_cast<char*>(data), size);
+    if (size_t(stream_.gcount()) != size) return false;
+    checksum_.update(static_cast<const char*>(data), size);
+    return true;
+  }
+  template <typename T>
+  bool read(T& value) {
+    return read(&value, sizeof(T));
+  }
+  // Sizes are only validated by the checksum at the end of the file,
+  // so vectors grow with the data read, rather than being sized from
+  // a count that may be corrupt
+  template <typename T>
+  bool readVector(std::vector<T>& v, const size_t count) {
+    return readGrowing(v, count);
+  }
+  bool readString(std::string& s, const size_t count) {
+    return readGrowing(s, count);
+  }
+  // Integers written by a build with a different width of HighsInt
+  // are converted
+  bool readIntVector(std::vector<HighsInt>& v, const size_t count) {
+    if (int_width == sizeof(HighsInt)) return readVector(v, count);
+    return int_width == 4 ? readConverted<int32_t>(v, count)
+                          : readConverted<int64_t>(v, count);
+  }
+  bool skip(uint64_t size) {
+    char buffer[4096];
+    while (size) {
+      const size_t chunk = std::min(size, uint64_t(sizeof(buffer)));
+      if (!read(buffer, chunk)) return false;
+      size -= chunk;
+    }
+    return true;
+  }
+  bool checkEnd() {
+    const uint64_t checksum = checksum_.value();
+    uint64_t file_checksum;
+    stream_.read(reinterpret_cast<char*>(&file_checksum),
+                 sizeof(file_checksum));
+    return size_t(stream_.gcount()) == sizeof(file_checksum) &&
+           file_checksum == checksum;
+  }
+
+ private:
+  std::istream& stream_;
+  HbmChecksum checksum_;
+
+  // Reads count elements into c, at most doubling its size with each
+  // read
+  template <typename C>
+  bool readGrowing(C& c, const size_t count) {
+    const size_t min_chunk = (size_t(1) << 16) / sizeof(c[0]);
+    c.clear();
+    while (c.size() < count) {
+      const size_t start = c.size();
+      const size_t chunk = std::min(count - start, std::max(start, min_chunk));
+      c.resize(start + chunk);
+      if (!read(&c[start], chunk * sizeof(c[0]))) return false;
+    }
+    return true;
+  }
+
+  template <typename T>
+  bool readConverted(std::vector<HighsInt>& v, const size_t count) {
+    std::vector<T> file_v;
+    if (!readVector(file_v, count)) return false;
+    v.resize(count);
+    for (size_t k = 0; k < count; k++) {
+      if (file_v[k] > std::numeric_limits<HighsInt>::max() ||
+          file_v[k] < std::numeric_limits<HighsInt>::min())
+        return false;
+      v[k] = HighsInt(file_v[k]);
+    }
+    return true;
+  }
+};
+
+size_t namesSize(const std::vector<std::string>& names) {
+  size_t size = 0;
+  for (const std::string& name : names) size += name.size() + 1;
+  return size;
+}
+
+void writeNames(HbmWriter& writer, const std::vector<std::string>& names) {
+  for (const std::string& name : names)
+    writer.write(name.c_str(), name.size() + 1);
+}
+
+// Extracts count names from the null-terminated strings in blob,
+// starting at pos
+bool readNames(const std::string& blob, size_t& pos, const int64_t count,
+               std::vector<std::string>& names) {
+  names.resize(count);
+  for (int64_t k = 0; k < count; k++) {
+    const size_t end = blob.find('\0', pos);
+    if (end == std::string::npos) return false;
+    names[k].assign(blob, pos, end - pos);
+    pos = end + 1;
+  }
+  return true;
+}
+
+bool isGzFilename(const std::string& filename) {
+  return filename.size() > 3 &&
+         filename.compare(filename.size() - 3, 3, ".gz") == 0;
+}
+
+}  // namespace
+
+FilereaderRetcode FilereaderHbm::readModelFromFile(const HighsOptions& options,
+                                                   const std::string filename,
+                                                   HighsModel& model) {
+  const HighsLogOptions& log_options = options.log_options;
+  // zstr::ifstream reads uncompressed files as they are
+#ifdef ZLIB_FOUND
+  zstr::ifstream f;
+  try {
+    f.open(filename, std::ios::in | std::ios::binary);
+  } catch (const strict_fstream::Exception& e) {
+    highsLogDev(log_options, HighsLogType::kInfo, "%s\n", e.what());
+    return FilereaderRetcode::kFileNotFound;
+  }
+#else
+  std::ifstream f;
+  f.open(filename, std::ios::in | std::ios::binary);
+#endif
+  if (!f.is_open()) return FilereaderRetcode::kFileNotFound;
+
+  HbmReader reader(f);
+  char magic[8];
+  uint32_t version;
+  uint32_t byte_order;
+  uint8_t double_width;
+  if (!reader.read(magic, sizeof(magic)) ||
+      memcmp(magic, kHbmMagic, sizeof(magic)) != 0 ||
+      !reader.read(version) || !reader.read(byte_order) ||
+      !reader.read(reader.int_width) || !reader.read(double_width)) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "File %s is not a HiGHS binary model file\n",
+                 filename.c_str());
+    return FilereaderRetcode::kParserError;
+  }
+  if (version > kHbmVersion) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "HiGHS binary model file has version %d, but only "
+                 "versions up to %d can be read\n",
+                 (int)version, (int)kHbmVersion);
+    return FilereaderRetcode::kParserError;
+  }
+  if (byte_order != kHbmByteOrder || double_width != sizeof(double) ||
+      (reader.int_width != 4 && reader.int_width != 8)) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "HiGHS binary model file was written on a machine with "
+                 "different byte order or number formats\n");
+    return FilereaderRetcode::kParserError;
+  }
+
+  HighsLp& lp = model.lp_;
+  HighsHessian& hessian = model.hessian_;
+  basis_.clear();
+  solution_.clear();
+  bool have_dimensions = false;
+  bool have_matrix = false;
+  bool ok = true;
+  for (;;) {
+    uint32_t tag;
+    uint64_t size;
+    if (!reader.read(tag)) {
+      ok = false;
+      break;
+    }
+    if (tag == kHbmEnd) break;
+    if (!reader.read(size)) {
+      ok = false;
+      break;
+    }
+    const size_t num_col = lp.num_col_;
+    const size_t num_row = lp.num_row_;
+    const size_t num_tot = num_col + num_row;
+    // All sections other than the dimensions require them
+    if (tag != kHbmDimensions && tag <= kHbmSolution && !have_dimensions) {
+      ok = false;
+      break;
+    }
+    switch (tag) {
+      case kHbmDimensions: {
+        int64_t file_num_col, file_num_row;
+        int32_t sense;
+        ok = size == 2 * sizeof(int64_t) + sizeof(int32_t) + sizeof(double) &&
+             reader.read(file_num_col) && reader.read(file_num_row) &&
+             reader.read(sense) && reader.read(lp.offset_) &&
+             file_num_col >= 0 && file_num_row >= 0 &&
+             file_num_col <= kHighsIInf && file_num_row <= kHighsIInf;
+        if (!ok) break;
+        lp.num_col_ = file_num_col;
+        lp.num_row_ = file_num_row;
+        lp.sense_ = sense == (int32_t)ObjSense::kMaximize ? ObjSense::kMaximize
+                                                          : ObjSense::kMinimize;
+        have_dimensions = true;
+        break;
+      }
+      case kHbmCost:
+        ok = size == num_col * sizeof(double) &&
+             reader.readVector(lp.col_cost_, num_col);
+        break;
+      case kHbmColBounds:
+        ok = size == 2 * num_col * sizeof(double) &&
+             reader.readVector(lp.col_lower_, num_col) &&
+             reader.readVector(lp.col_upper_, num_col);
+        break;
+      case kHbmRowBounds:
+        ok = size == 2 * num_row * sizeof(double) &&
+             reader.readVector(lp.row_lower_, num_row) &&
+             reader.readVector(lp.row_upper_, num_row);
+        break;
+      case kHbmMatrix: {
+        int64_t num_nz;
+        ok = reader.read(num_nz) && num_nz >= 0 &&
+             size == sizeof(int64_t) +
+                         (num_col + 1 + num_nz) * reader.int_width +
+                         num_nz * sizeof(double) &&
+             reader.readIntVector(lp.a_matrix_.start_, num_col + 1) &&
+             reader.readIntVector(lp.a_matrix_.index_, num_nz) &&
+             reader.readVector(lp.a_matrix_.value_, num_nz) &&
+             lp.a_matrix_.start_[0] == 0 &&
+             lp.a_matrix_.start_[num_col] == num_nz;
+        lp.a_matrix_.format_ = MatrixFormat::kColwise;
+        lp.a_matrix_.num_col_ = lp.num_col_;
+        lp.a_matrix_.num_row_ = lp.num_row_;
+        have_matrix = ok;
+        break;
+      }
+      case kHbmIntegrality:
+        ok = size == num_col && reader.readVector(lp.integrality_, num_col);
+        break;
+      case kHbmHessian: {
+        int64_t dim, num_nz;
+        int32_t format;
+        ok = reader.read(dim) && reader.read(format) && reader.read(num_nz) &&
+             dim == int64_t(num_col) && num_nz >= 0 &&
+             size == 2 * sizeof(int64_t) + sizeof(int32_t) +
+                         (dim + 1 + num_nz) * reader.int_width +
+                         num_nz * sizeof(double) &&
+             reader.readIntVector(hessian.start_, dim + 1) &&
+             reader.readIntVector(hessian.index_, num_nz) &&
+             reader.readVector(hessian.value_, num_nz) &&
+             hessian.start_[0] == 0 && hessian.start_[dim] == num_nz;
+        hessian.dim_ = dim;
+        hessian.format_ = format == (int32_t)HessianFormat::kSquare
+                              ? HessianFormat::kSquare
+                              : HessianFormat::kTriangular;
+        break;
+      }
+      case kHbmNames: {
+        std::string blob;
+        ok = reader.readString(blob, size);
+        if (!ok) break;
+        int64_t num_col_name, num_row_name;
+        size_t pos = 2 * sizeof(int64_t);
+        ok = size >= pos;
+        if (!ok) break;
+        memcpy(&num_col_name, &blob[0], sizeof(int64_t));
+        memcpy(&num_row_name, &blob[sizeof(int64_t)], sizeof(int64_t));
+        std::vector<std::string> names;
+        ok = (num_col_name == 0 || num_col_name == int64_t(num_col)) &&
+             (num_row_name == 0 || num_row_name == int64_t(num_row)) &&
+             readNames(blob, pos, 2, names) &&
+             readNames(blob, pos, num_col_name, lp.col_names_) &&
+             readNames(blob, pos, num_row_name, lp.row_names_);
+        if (!ok) break;
+        lp.model_name_ = names[0];
+        lp.objective_name_ = names[1];
+        break;
+      }
+      case kHbmBasis:
+        ok = size == num_tot &&
+             reader.readVector(basis_.col_status, num_col) &&
+             reader.readVector(basis_.row_status, num_row);
+        basis_.valid = ok;
+        basis_.alien = false;
+        break;
+      case kHbmSolution: {
+        uint8_t dual_valid;
+        ok = reader.read(dual_valid) &&
+             size == 1 + (dual_valid ? 2 : 1) * num_tot * sizeof(double) &&
+             reader.readVector(solution_.col_value, num_col) &&
+             reader.readVector(solution_.row_value, num_row);
+        if (ok && dual_valid)
+          ok = reader.readVector(solution_.col_dual, num_col) &&
+               reader.readVector(solution_.row_dual, num_row);
+        solution_.value_valid = ok;
+        solution_.dual_valid = ok && dual_valid;
+        break;
+      }
+      default:
+        // Section added by a later version of the format
+        ok = reader.skip(size);
+    }
+    if (!ok) break;
+  }
+  if (ok && !reader.checkEnd()) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "HiGHS binary model file %s is corrupt: checksum error\n",
+                 filename.c_str());
+    return FilereaderRetcode::kParserError;
+  }
+  if (!ok || !have_dimensions || !have_matrix ||
+      lp.col_cost_.size() != size_t(lp.num_col_) ||
+      lp.col_lower_.size() != size_t(lp.num_col_) ||
+      lp.row_lower_.size() != size_t(lp.num_row_)) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "HiGHS binary model file %s is incomplete or corrupt\n",
+                 filename.c_str());
+    return FilereaderRetcode::kParserError;
+  }
+  return FilereaderRetcode::kOk;
+}
+
+HighsStatus FilereaderHbm::writeModelToFile(const HighsOptions& options,
+                                            const std::string filename,
+                                            const HighsModel& model) {
+  const HighsLp& lp = model.lp_;
+  const HighsHessian& hessian = model.hessian_;
+  assert(lp.a_matrix_.isColwise());
+  std::unique_ptr<std::ostream> f;
+  if (isGzFilename(filename)) {
+#ifdef ZLIB_FOUND
+    try {
+      f.reset(new zstr::ofstream(filename, std::ios::out | std::ios::binary));
+    } catch (const strict_fstream::Exception& e) {
+      highsLogUser(options.log_options, HighsLogType::kError, "%s\n",
+                   e.what());
+      return HighsStatus::kError;
+    }
+#else
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "HiGHS build without zlib support. Cannot write .gz file.\n");
+    return HighsStatus::kError;
+#endif
+  } else {
+    std::ofstream* file =
+        new std::ofstream(filename, std::ios::out | std::ios::binary);
+    f.reset(file);
+    if (!file->is_open()) {
+      highsLogUser(options.log_options, HighsLogType::kError,
+                   "Cannot open file %s\n", filename.c_str());
+      return HighsStatus::kError;
+    }
+  }
+
+  const uint64_t num_col = lp.num_col_;
+  const uint64_t num_row = lp.num_row_;
+  const uint64_t num_tot = num_col + num_row;
+  const uint64_t int_width = sizeof(HighsInt);
+  HbmWriter writer(*f);
+  writer.write(kHbmMagic, sizeof(kHbmMagic));
+  writer.write(kHbmVersion);
+  writer.write(kHbmByteOrder);
+  writer.write(uint8_t(sizeof(HighsInt)));
+  writer.write(uint8_t(sizeof(double)));
+
+  writer.writeSection(kHbmDimensions, 2 * sizeof(int64_t) + sizeof(int32_t) +
+                                          sizeof(double));
+  writer.write(int64_t(num_col));
+  writer.write(int64_t(num_row));
+  writer.write(int32_t(lp.sense_));
+  writer.write(lp.offset_);
+
+  writer.writeSection(kHbmCost, num_col * sizeof(double));
+  writer.writeVector(lp.col_cost_);
+  writer.writeSection(kHbmColBounds, 2 * num_col * sizeof(double));
+  writer.writeVector(lp.col_lower_);
+  writer.writeVector(lp.col_upper_);
+  writer.writeSection(kHbmRowBounds, 2 * num_row * sizeof(double));
+  writer.writeVector(lp.row_lower_);
+  writer.writeVector(lp.row_upper_);
+
+  const uint64_t num_nz = lp.a_matrix_.numNz();
+  writer.writeSection(kHbmMatrix, sizeof(int64_t) +
+                                      (num_col + 1 + num_nz) * int_width +
+                                      num_nz * sizeof(double));
+  writer.write(int64_t(num_nz));
+  writer.write(lp.a_matrix_.start_.data(), (num_col + 1) * int_width);
+  writer.write(lp.a_matrix_.index_.data(), num_nz * int_width);
+  writer.write(lp.a_matrix_.value_.data(), num_nz * sizeof(double));
+
+  if (lp.integrality_.size()) {
+    writer.writeSection(kHbmIntegrality, num_col);
+    writer.writeVector(lp.integrality_);
+  }
+
+  if (hessian.dim_) {
+    const uint64_t hessian_num_nz = hessian.numNz();
+    writer.writeSection(kHbmHessian,
+                        2 * sizeof(int64_t) + sizeof(int32_t) +
+                            (hessian.dim_ + 1 + hessian_num_nz) * int_width +
+                            hessian_num_nz * sizeof(double));
+    writer.write(int64_t(hessian.dim_));
+    writer.write(int32_t(hessian.format_));
+    writer.write(int64_t(hessian_num_nz));
+    writer.write(hessian.start_.data(), (hessian.dim_ + 1) * int_width);
+    writer.write(hessian.index_.data(), hessian_num_nz * int_width);
+    writer.write(hessian.value_.data(), hessian_num_nz * sizeof(double));
+  }
+
+  // Names are written as null-terminated strings, preceded by the
+  // numbers of column and row names
+  const bool have_col_names = lp.col_names_.size() == num_col;
+  const bool have_row_names = lp.row_names_.size() == num_row;
+  std::vector<std::string> names = {lp.model_name_, lp.objective_name_};
+  writer.writeSection(
+      kHbmNames, 2 * sizeof(int64_t) + namesSize(names) +
+                     (have_col_names ? namesSize(lp.col_names_) : 0) +
+                     (have_row_names ? namesSize(lp.row_names_) : 0));
+  writer.write(int64_t(have_col_names ? num_col : 0));
+  writer.write(int64_t(have_row_names ? num_row : 0));
+  writeNames(writer, names);
+  if (have_col_names) writeNames(writer, lp.col_names_);
+  if (have_row_names) writeNames(writer, lp.row_names_);
+
+  if (basis_.valid && basis_.col_status.size() == num_col &&
+      basis_.row_status.size() == num_row) {
+    writer.writeSection(kHbmBasis, num_tot);
+    writer.writeVector(basis_.col_status);
+    writer.writeVector(basis_.row_status);
+  }
+
+  if (solution_.value_valid && solution_.col_value.size() == num_col &&
+      solution_.row_value.size() == num_row) {
+    const uint8_t dual_valid = solution_.dual_valid &&
+                               solution_.col_dual.size() == num_col &&
+                               solution_.row_dual.size() == num_row;
+    writer.writeSection(kHbmSolution,
+                        1 + (dual_valid ? 2 : 1) * num_tot * sizeof(double));
+    writer.write(dual_valid);
+    writer.writeVector(solution_.col_value);
+    writer.writeVector(solution_.row_value);
+    if (dual_valid) {
+      writer.writeVector(solution_.col_dual);
+      writer.writeVector(solution_.row_dual);
+    }
+  }
+
+  writer.writeEnd();
+  f->flush();
+  if (!writer.ok()) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Error writing HiGHS binary model file %s\n",
+                 filename.c_str());
+    return HighsStatus::kError;
+  }
+  return HighsStatus::kOk;
+}
@@ -0,0 +1,38 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/FilereaderHbm.h
+ * @brief Binary model files, with an optional basis and solution
+ */
+
+#ifndef IO_FILEREADER_HBM_H_
+#define IO_FILEREADER_HBM_H_
+
+#include "io/Filereader.h"
+#include "io/HighsIO.h"  // For messages.
+
+// A .hbm file starts with a header giving the format version and the
+// byte order and widths of the integers and doubles in the file. This
+// is followed by tagged sections, each holding the raw arrays of part
+// of the model, and then a checksum of everything before it. Unknown
+// sections are skipped, so that later versions can add sections. If
+// the file name ends in .gz, the file is compressed using zlib.
+class FilereaderHbm : public Filereader {
+ public:
+  FilereaderRetcode readModelFromFile(const HighsOptions& options,
+                                      const std::string filename,
+                                      HighsModel& model);
+  HighsStatus writeModelToFile(const HighsOptions& options,
+                               const std::string filename,
+                               const HighsModel& model);
+  bool holdsSolution() const { return true; }
+};
+
+#endif
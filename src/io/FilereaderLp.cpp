@@ -17,9 +17,9 @@
 #include <cstdarg>
 #include <cstdio>
 #include <exception>
-#include <map>
 
 #include "../extern/filereaderlp/reader.hpp"
+#include "io/HighsTextWriter.h"
 #include "lp_data/HighsLpUtils.h"
 
 const bool original_double_format = false;
@@ -39,117 +39,96 @@ FilereaderRetcode FilereaderLp::readModelFromFile(const HighsOptions& options,
       return FilereaderRetcode::kParserError;
     }
 
-    // build variable index and gather variable information
-    std::map<std::string, unsigned int> varindex;
-
+    // gather variable information
     lp.num_col_ = m.variables.size();
     lp.num_row_ = m.constraints.size();
     lp.row_names_.resize(m.constraints.size());
     lp.integrality_.assign(lp.num_col_, HighsVarType::kContinuous);
+    lp.col_lower_.resize(lp.num_col_);
+    lp.col_upper_.resize(lp.num_col_);
+    lp.col_names_.resize(lp.num_col_);
     HighsInt num_continuous = 0;
-    for (size_t i = 0; i < m.variables.size(); i++) {
-      varindex[m.variables[i]->name] = i;
-      lp.col_lower_.push_back(m.variables[i]->lowerbound);
-      lp.col_upper_.push_back(m.variables[i]->upperbound);
-      lp.col_names_.push_back(m.variables[i]->name);
-      if (m.variables[i]->type == VariableType::BINARY ||
-          m.variables[i]->type == VariableType::GENERAL) {
+    for (HighsInt i = 0; i < lp.num_col_; i++) {
+      Variable& var = m.variables[i];
+      lp.col_lower_[i] = var.lowerbound;
+      lp.col_upper_[i] = var.upperbound;
+      lp.col_names_[i] = std::move(var.name);
+      if (var.type == VariableType::BINARY ||
+          var.type == VariableType::GENERAL) {
         lp.integrality_[i] = HighsVarType::kInteger;
-      } else if (m.variables[i]->type == VariableType::SEMICONTINUOUS) {
+      } else if (var.type == VariableType::SEMICONTINUOUS) {
         lp.integrality_[i] = HighsVarType::kSemiContinuous;
-      } else if (m.variables[i]->type == VariableType::SEMIINTEGER) {
+      } else if (var.type == VariableType::SEMIINTEGER) {
         lp.integrality_[i] = HighsVarType::kSemiInteger;
       } else {
         lp.integrality_[i] = HighsVarType::kContinuous;
         num_continuous++;
       }
     }
+    std::vector<Variable>().swap(m.variables);
     // Clear lp.integrality_ if problem is pure LP
-    if (static_cast<size_t>(num_continuous) == m.variables.size())
-      lp.integrality_.clear();
+    if (num_continuous == lp.num_col_) lp.integrality_.clear();
     // get objective
-    lp.objective_name_ = m.objective->name;
-    // ToDo: Fix m.objective->offset and then use it here
+    lp.objective_name_ = m.objective.name;
+    // ToDo: Fix m.objective.offset and then use it here
     //
-    lp.offset_ = m.objective->offset;
+    lp.offset_ = m.objective.offset;
     lp.col_cost_.resize(lp.num_col_, 0.0);
-    for (size_t i = 0; i < m.objective->linterms.size(); i++) {
-      std::shared_ptr<LinTerm> lt = m.objective->linterms[i];
-      lp.col_cost_[varindex[lt->var->name]] = lt->coef;
-    }
-
-    std::map<std::shared_ptr<Variable>, std::vector<std::shared_ptr<Variable>>>
-        mat;
-    std::map<std::shared_ptr<Variable>, std::vector<double>> mat2;
-    for (std::shared_ptr<QuadTerm> qt : m.objective->quadterms) {
-      if (qt->var1 != qt->var2) {
-        mat[qt->var1].push_back(qt->var2);
-        mat2[qt->var1].push_back(qt->coef / 2);
-        mat[qt->var2].push_back(qt->var1);
-        mat2[qt->var2].push_back(qt->coef / 2);
-      } else {
-        mat[qt->var1].push_back(qt->var2);
-        mat2[qt->var1].push_back(qt->coef);
-      }
+    for (const LinTerm& lt : m.objective.linterms)
+      lp.col_cost_[lt.var] = lt.coef;
+
+    // Set up the Hessian in square format, each off-diagonal term
+    // contributing half of its coefficient to each of the two entries,
+    // by counting the nonzero entries in each column
+    std::vector<HighsInt> count(lp.num_col_, 0);
+    for (const QuadTerm& qt : m.objective.quadterms) {
+      if (!qt.coef) continue;
+      count[qt.var1]++;
+      if (qt.var1 != qt.var2) count[qt.var2]++;
     }
-
-    // Determine whether there is a Hessian to set up by counting its
-    // nonzero entries
-    unsigned int qnnz = 0;
-    for (std::shared_ptr<Variable> var : m.variables)
-      for (size_t i = 0; i < mat[var].size(); i++)
-        if (mat2[var][i]) qnnz++;
+    HighsInt qnnz = 0;
+    for (HighsInt i = 0; i < lp.num_col_; i++) qnnz += count[i];
     if (qnnz) {
-      hessian.dim_ = m.variables.size();
-      qnnz = 0;
-      // model_.hessian_ is initialised with start_[0] for fictitious
-      // column 0, so have to clear this before pushing back start
-      hessian.start_.clear();
-      assert((int)hessian.start_.size() == 0);
-      for (std::shared_ptr<Variable> var : m.variables) {
-        hessian.start_.push_back(qnnz);
-        for (size_t i = 0; i < mat[var].size(); i++) {
-          double value = mat2[var][i];
-          if (value) {
-            hessian.index_.push_back(varindex[mat[var][i]->name]);
-            hessian.value_.push_back(value);
-            qnnz++;
-          }
+      hessian.dim_ = lp.num_col_;
+      hessian.start_.resize(lp.num_col_ + 1);
+      hessian.start_[0] = 0;
+      for (HighsInt i = 0; i < lp.num_col_; i++) {
+        hessian.start_[i + 1] = hessian.start_[i] + count[i];
+        count[i] = hessian.start_[i];
+      }
+      hessian.index_.resize(qnnz);
+      hessian.value_.resize(qnnz);
+      for (const QuadTerm& qt : m.objective.quadterms) {
+        if (!qt.coef) continue;
+        if (qt.var1 != qt.var2) {
+          hessian.index_[count[qt.var1]] = qt.var2;
+          hessian.value_[count[qt.var1]++] = qt.coef / 2;
+          hessian.index_[count[qt.var2]] = qt.var1;
+          hessian.value_[count[qt.var2]++] = qt.coef / 2;
+        } else {
+          hessian.index_[count[qt.var1]] = qt.var1;
+          hessian.value_[count[qt.var1]++] = qt.coef;
         }
       }
-      hessian.start_.push_back(qnnz);
       hessian.format_ = HessianFormat::kSquare;
     } else {
       assert(hessian.dim_ == 0 && hessian.start_[0] == 0);
     }
 
     // handle constraints
-    std::map<std::shared_ptr<Variable>, std::vector<unsigned int>>
-        consofvarmap_index;
-    std::map<std::shared_ptr<Variable>, std::vector<double>> consofvarmap_value;
-    for (size_t i = 0; i < m.constraints.size(); i++) {
-      std::shared_ptr<Constraint> con = m.constraints[i];
-      lp.row_names_[i] = con->expr->name;
-      for (size_t j = 0; j < con->expr->linterms.size(); j++) {
-        std::shared_ptr<LinTerm> lt = con->expr->linterms[j];
-        if (consofvarmap_index.count(lt->var) == 0) {
-          consofvarmap_index[lt->var] = std::vector<unsigned int>();
-          consofvarmap_value[lt->var] = std::vector<double>();
-        }
-        consofvarmap_index[lt->var].push_back(i);
-        consofvarmap_value[lt->var].push_back(lt->coef);
-      }
-
-      lp.row_lower_.push_back(con->lowerbound);
-      lp.row_upper_.push_back(con->upperbound);
-
-      if (!con->expr->quadterms.empty()) {
+    lp.row_lower_.resize(lp.num_row_);
+    lp.row_upper_.resize(lp.num_row_);
+    for (HighsInt i = 0; i < lp.num_row_; i++) {
+      Constraint& con = m.constraints[i];
+      if (con.numquadterms) {
         highsLogUser(options.log_options, HighsLogType::kError,
                      "Quadratic constraints not supported by HiGHS\n");
         return FilereaderRetcode::kParserError;
       }
+      lp.row_names_[i] = std::move(con.name);
+      lp.row_lower_[i] = con.lowerbound;
+      lp.row_upper_[i] = con.upperbound;
     }
-
     // Check for empty row names, giving them a special name if possible
     bool highs_prefix_ok = true;
     bool used_highs_prefix = false;
@@ -175,24 +154,30 @@ FilereaderRetcode FilereaderLp::readModelFromFile(const HighsOptions& options,
                    "with same prefix: row names cleared\n");
     }
 
-    HighsInt nz = 0;
-    // lp.a_matrix_ is initialised with start_[0] for fictitious
-    // column 0, so have to clear this before pushing back start
-    lp.a_matrix_.start_.clear();
-    assert((int)lp.a_matrix_.start_.size() == 0);
+    // The constraint matrix is held row-wise by the reader, so form
+    // its column-wise copy by counting the nonzeros in each column
+    count.assign(lp.num_col_, 0);
+    for (const LinTerm& lt : m.constraintterms)
+      if (lt.coef) count[lt.var]++;
+    lp.a_matrix_.start_.resize(lp.num_col_ + 1);
+    lp.a_matrix_.start_[0] = 0;
     for (HighsInt i = 0; i < lp.num_col_; i++) {
-      std::shared_ptr<Variable> var = m.variables[i];
-      lp.a_matrix_.start_.push_back(nz);
-      for (size_t j = 0; j < consofvarmap_index[var].size(); j++) {
-        double value = consofvarmap_value[var][j];
-        if (value) {
-          lp.a_matrix_.index_.push_back(consofvarmap_index[var][j]);
-          lp.a_matrix_.value_.push_back(value);
-          nz++;
-        }
+      lp.a_matrix_.start_[i + 1] = lp.a_matrix_.start_[i] + count[i];
+      count[i] = lp.a_matrix_.start_[i];
+    }
+    const HighsInt nz = lp.a_matrix_.start_[lp.num_col_];
+    lp.a_matrix_.index_.resize(nz);
+    lp.a_matrix_.value_.resize(nz);
+    for (HighsInt i = 0; i < lp.num_row_; i++) {
+      for (size_t k = m.constraintstart[i]; k < m.constraintstart[i + 1];
+           k++) {
+        const LinTerm& lt = m.constraintterms[k];
+        if (!lt.coef) continue;
+        lp.a_matrix_.index_[count[lt.var]] = i;
+        lp.a_matrix_.value_[count[lt.var]++] = lt.coef;
       }
     }
-    lp.a_matrix_.start_.push_back(nz);
+    std::vector<LinTerm>().swap(m.constraintterms);
     lp.a_matrix_.format_ = MatrixFormat::kColwise;
     lp.sense_ = m.sense == ObjectiveSense::MIN ? ObjSense::kMinimize
                                                : ObjSense::kMaximize;
@@ -213,57 +198,58 @@ FilereaderRetcode FilereaderLp::readModelFromFile(const HighsOptions& options,
   return FilereaderRetcode::kOk;
 }
 
-void FilereaderLp::writeToFile(FILE* file, const char* format, ...) {
+void FilereaderLp::writeToFile(LpText& out, const char* format, ...) {
   va_list argptr;
   va_start(argptr, format);
   char stringbuffer[LP_MAX_LINE_LENGTH + 1];
   HighsInt tokenlength =
       vsnprintf(stringbuffer, sizeof stringbuffer, format, argptr);
   va_end(argptr);
-  if (this->linelength + tokenlength >= LP_MAX_LINE_LENGTH) {
-    fprintf(file, "\n");
-    fprintf(file, "%s", stringbuffer);
-    this->linelength = tokenlength;
+  if (out.linelength + tokenlength >= LP_MAX_LINE_LENGTH) {
+    out.text += "\n";
+    out.text += stringbuffer;
+    out.linelength = tokenlength;
   } else {
-    fprintf(file, "%s", stringbuffer);
-    this->linelength += tokenlength;
+    out.text += stringbuffer;
+    out.linelength += tokenlength;
   }
 }
 
-void FilereaderLp::writeToFileLineend(FILE* file) {
-  fprintf(file, "\n");
-  this->linelength = 0;
+void FilereaderLp::writeToFileLineend(LpText& out) {
+  out.text += "\n";
+  out.linelength = 0;
 }
 
-void FilereaderLp::writeToFileValue(FILE* file, const double value,
+void FilereaderLp::writeToFileValue(LpText& out, const double value,
                                     const bool force_plus) {
   if (original_double_format) {
-    this->writeToFile(file, " %+g", value);
+    this->writeToFile(out, " %+g", value);
   } else {
     // As for writeModelAsMps
     if (force_plus) {
-      this->writeToFile(file, " %+.15g", value);
+      this->writeToFile(out, " %+.15g", value);
     } else {
-      this->writeToFile(file, " %.15g", value);
+      this->writeToFile(out, " %.15g", value);
     }
   }
 }
 
-void FilereaderLp::writeToFileVar(FILE* file, const HighsInt var_index) {
-  this->writeToFile(file, " x%" HIGHSINT_FORMAT, var_index + 1);
+void FilereaderLp::writeToFileVar(LpText& out, const HighsInt var_index) {
+  this->writeToFile(out, " x%" HIGHSINT_FORMAT, var_index + 1);
 }
 
-void FilereaderLp::writeToFileVar(FILE* file, const std::string var_name) {
-  this->writeToFile(file, " %s", var_name.c_str());
+void FilereaderLp::writeToFileVar(LpText& out,
+                                  const std::string& var_name) {
+  this->writeToFile(out, " %s", var_name.c_str());
 }
 
-void FilereaderLp::writeToFileCon(FILE* file, const HighsInt con_index) {
-  this->writeToFile(file, " con%" HIGHSINT_FORMAT, con_index + 1);
+void FilereaderLp::writeToFileCon(LpText& out, const HighsInt con_index) {
+  this->writeToFile(out, " con%" HIGHSINT_FORMAT, con_index + 1);
 }
 
-void FilereaderLp::writeToFileMatrixRow(FILE* file, const HighsInt iRow,
-                                        const HighsSparseMatrix ar_matrix,
-                                        const std::vector<string> col_names) {
+void FilereaderLp::writeToFileMatrixRow(
+    LpText& out, const HighsInt iRow, const HighsSparseMatrix& ar_matrix,
+    const std::vector<string>& col_names) {
   assert(ar_matrix.isRowwise());
   const bool has_col_names = allow_model_names && col_names.size() > 0;
 
@@ -271,11 +257,72 @@ void FilereaderLp::writeToFileMatrixRow(FILE* file, const HighsInt iRow,
        iEl++) {
     HighsInt iCol = ar_matrix.index_[iEl];
     double coef = ar_matrix.value_[iEl];
-    this->writeToFileValue(file, coef);
+    this->writeToFileValue(out, coef);
     if (has_col_names) {
-      this->writeToFileVar(file, col_names[iCol]);
+      this->writeToFileVar(out, col_names[iCol]);
+    } else {
+      this->writeToFileVar(out, iCol);
+    }
+  }
+}
+
+void FilereaderLp::writeToFileRows(LpText& out, const HighsInt from_row,
+                                   const HighsInt to_row, const HighsLp& lp,
+                                   const HighsSparseMatrix& ar_matrix,
+                                   const bool has_row_names) {
+  const std::vector<string>& col_names = lp.col_names_;
+  for (HighsInt iRow = from_row; iRow < to_row; iRow++) {
+    if (lp.row_lower_[iRow] == lp.row_upper_[iRow]) {
+      // Equality constraint
+      if (has_row_names) {
+        this->writeToFileVar(out, lp.row_names_[iRow]);
+      } else {
+        this->writeToFileCon(out, iRow);
+      }
+      this->writeToFile(out, ":");
+      this->writeToFileMatrixRow(out, iRow, ar_matrix, col_names);
+      this->writeToFile(out, " =");
+      this->writeToFileValue(out, lp.row_lower_[iRow], true);
+      this->writeToFileLineend(out);
     } else {
-      this->writeToFileVar(file, iCol);
+      // Need to distinguish the names when writing out boxed
+      // constraint row as two single-sided constraints
+      const bool boxed =
+          lp.row_lower_[iRow] > -kHighsInf && lp.row_upper_[iRow] < kHighsInf;
+      if (lp.row_lower_[iRow] > -kHighsInf) {
+        // Has a lower bound
+        if (has_row_names) {
+          this->writeToFileVar(out, lp.row_names_[iRow]);
+        } else {
+          this->writeToFileCon(out, iRow);
+        }
+        if (boxed) {
+          this->writeToFile(out, "lo:");
+        } else {
+          this->writeToFile(out, ":");
+        }
+        this->writeToFileMatrixRow(out, iRow, ar_matrix, col_names);
+        this->writeToFile(out, " >=");
+        this->writeToFileValue(out, lp.row_lower_[iRow], true);
+        this->writeToFileLineend(out);
+      }
+      if (lp.row_upper_[iRow] < kHighsInf) {
+        // Has an upper bound
+        if (has_row_names) {
+          this->writeToFileVar(out, lp.row_names_[iRow]);
+        } else {
+          this->writeToFileCon(out, iRow);
+        }
+        if (boxed) {
+          this->writeToFile(out, "up:");
+        } else {
+          this->writeToFile(out, ":");
+        }
+        this->writeToFileMatrixRow(out, iRow, ar_matrix, col_names);
+        this->writeToFile(out, " <=");
+        this->writeToFileValue(out, lp.row_upper_[iRow], true);
+        this->writeToFileLineend(out);
+      }
     }
   }
 }
@@ -294,32 +341,38 @@ HighsStatus FilereaderLp::writeModelToFile(const HighsOptions& options,
   const bool has_row_names =
       allow_model_names &&
       lp.row_names_.size() == static_cast<size_t>(lp.num_row_);
-  FILE* file = fopen(filename.c_str(), "w");
+  HighsTextWriter file;
+  if (!file.open(filename)) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Cannot open file %s\n", filename.c_str());
+    return HighsStatus::kError;
+  }
+  LpText out;
 
   // write comment at the start of the file
-  this->writeToFile(file, "\\ %s", LP_COMMENT_FILESTART);
-  this->writeToFileLineend(file);
+  this->writeToFile(out, "\\ %s", LP_COMMENT_FILESTART);
+  this->writeToFileLineend(out);
 
   // write objective
-  this->writeToFile(file, "%s",
+  this->writeToFile(out, "%s",
                     lp.sense_ == ObjSense::kMinimize ? "min" : "max");
-  this->writeToFileLineend(file);
-  this->writeToFile(file, " obj:");
+  this->writeToFileLineend(out);
+  this->writeToFile(out, " obj:");
   for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
     double coef = lp.col_cost_[iCol];
     if (coef != 0.0) {
-      this->writeToFileValue(file, coef);
+      this->writeToFileValue(out, coef);
       if (has_col_names) {
-        this->writeToFileVar(file, lp.col_names_[iCol]);
+        this->writeToFileVar(out, lp.col_names_[iCol]);
       } else {
-        this->writeToFileVar(file, iCol);
+        this->writeToFileVar(out, iCol);
       }
     }
   }
-  this->writeToFile(file,
+  this->writeToFile(out,
                     " ");  // ToDo Unnecessary, but only to give empty diff
   if (model.isQp()) {
-    this->writeToFile(file, "+ [");
+    this->writeToFile(out, "+ [");
     for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
       for (HighsInt iEl = model.hessian_.start_[iCol];
            iEl < model.hessian_.start_[iCol + 1]; iEl++) {
@@ -328,89 +381,59 @@ HighsStatus FilereaderLp::writeModelToFile(const HighsOptions& options,
           double coef = model.hessian_.value_[iEl];
           if (iCol != iRow) coef *= 2;
           if (coef != 0.0) {
-            this->writeToFileValue(file, coef);
+            this->writeToFileValue(out, coef);
             if (has_col_names) {
-              this->writeToFileVar(file, lp.col_names_[iCol]);
-              this->writeToFile(file, " *");
-              this->writeToFileVar(file, lp.col_names_[iRow]);
+              this->writeToFileVar(out, lp.col_names_[iCol]);
+              this->writeToFile(out, " *");
+              this->writeToFileVar(out, lp.col_names_[iRow]);
             } else {
-              this->writeToFileVar(file, iCol);
-              this->writeToFile(file, " *");
-              this->writeToFileVar(file, iRow);
+              this->writeToFileVar(out, iCol);
+              this->writeToFile(out, " *");
+              this->writeToFileVar(out, iRow);
             }
           }
         }
       }
     }
-    this->writeToFile(file,
+    this->writeToFile(out,
                       "  ]/2 ");  // ToDo Surely needs only to be one space
   }
   double coef = lp.offset_;
-  if (coef != 0) this->writeToFileValue(file, coef);
-  this->writeToFileLineend(file);
+  if (coef != 0) this->writeToFileValue(out, coef);
+  this->writeToFileLineend(out);
 
   // write constraint section, lower & upper bounds are one constraint
   // each
-  this->writeToFile(file, "st");
-  this->writeToFileLineend(file);
+  this->writeToFile(out, "st");
+  this->writeToFileLineend(out);
+  // The rows are formatted in parallel blocks of roughly kBlockNz
+  // nonzeros, each of which starts and ends a line
+  file.write(out.text);
+  out.text.clear();
+  const HighsInt kBlockNz = 1 << 16;
+  std::vector<HighsInt> block_start;
+  HighsInt block_nz = kBlockNz;
   for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++) {
-    if (lp.row_lower_[iRow] == lp.row_upper_[iRow]) {
-      // Equality constraint
-      if (has_row_names) {
-        this->writeToFileVar(file, lp.row_names_[iRow]);
-      } else {
-        this->writeToFileCon(file, iRow);
-      }
-      this->writeToFile(file, ":");
-      this->writeToFileMatrixRow(file, iRow, ar_matrix, lp.col_names_);
-      this->writeToFile(file, " =");
-      this->writeToFileValue(file, lp.row_lower_[iRow], true);
-      this->writeToFileLineend(file);
-    } else {
-      // Need to distinguish the names when writing out boxed
-      // constraint row as two single-sided constraints
-      const bool boxed =
-          lp.row_lower_[iRow] > -kHighsInf && lp.row_upper_[iRow] < kHighsInf;
-      if (lp.row_lower_[iRow] > -kHighsInf) {
-        // Has a lower bound
-        if (has_row_names) {
-          this->writeToFileVar(file, lp.row_names_[iRow]);
-        } else {
-          this->writeToFileCon(file, iRow);
-        }
-        if (boxed) {
-          this->writeToFile(file, "lo:");
-        } else {
-          this->writeToFile(file, ":");
-        }
-        this->writeToFileMatrixRow(file, iRow, ar_matrix, lp.col_names_);
-        this->writeToFile(file, " >=");
-        this->writeToFileValue(file, lp.row_lower_[iRow], true);
-        this->writeToFileLineend(file);
-      }
-      if (lp.row_upper_[iRow] < kHighsInf) {
-        // Has an upper bound
-        if (has_row_names) {
-          this->writeToFileVar(file, lp.row_names_[iRow]);
-        } else {
-          this->writeToFileCon(file, iRow);
-        }
-        if (boxed) {
-          this->writeToFile(file, "up:");
-        } else {
-          this->writeToFile(file, ":");
-        }
-        this->writeToFileMatrixRow(file, iRow, ar_matrix, lp.col_names_);
-        this->writeToFile(file, " <=");
-        this->writeToFileValue(file, lp.row_upper_[iRow], true);
-        this->writeToFileLineend(file);
-      }
+    if (block_nz >= kBlockNz) {
+      block_start.push_back(iRow);
+      block_nz = 0;
     }
+    block_nz += 1 + ar_matrix.start_[iRow + 1] - ar_matrix.start_[iRow];
   }
+  const HighsInt num_block = block_start.size();
+  block_start.push_back(lp.num_row_);
+  file.writeBlocks(num_block, [&](const HighsInt block, std::string& text) {
+    LpText block_out;
+    block_out.text.swap(text);
+    this->writeToFileRows(block_out, block_start[block],
+                          block_start[block + 1], lp, ar_matrix,
+                          has_row_names);
+    text.swap(block_out.text);
+  });
 
   // write bounds section
-  this->writeToFile(file, "bounds");
-  this->writeToFileLineend(file);
+  this->writeToFile(out, "bounds");
+  this->writeToFileLineend(out);
   for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
     const bool default_bounds =
         lp.col_lower_[iCol] == 0 && lp.col_upper_[iCol] == kHighsInf;
@@ -418,93 +441,98 @@ HighsStatus FilereaderLp::writeModelToFile(const HighsOptions& options,
     if (lp.col_lower_[iCol] <= -kHighsInf && lp.col_upper_[iCol] >= kHighsInf) {
       // Free variable
       if (has_col_names) {
-        this->writeToFileVar(file, lp.col_names_[iCol]);
+        this->writeToFileVar(out, lp.col_names_[iCol]);
       } else {
-        this->writeToFileVar(file, iCol);
+        this->writeToFileVar(out, iCol);
       }
-      this->writeToFile(file, " free");
+      this->writeToFile(out, " free");
     } else if (lp.col_lower_[iCol] == lp.col_upper_[iCol]) {
       // Fixed variable
       if (has_col_names) {
-        this->writeToFileVar(file, lp.col_names_[iCol]);
+        this->writeToFileVar(out, lp.col_names_[iCol]);
       } else {
-        this->writeToFileVar(file, iCol);
+        this->writeToFileVar(out, iCol);
       }
-      this->writeToFile(file, " =");
-      this->writeToFileValue(file, lp.col_upper_[iCol], false);
+      this->writeToFile(out, " =");
+      this->writeToFileValue(out, lp.col_upper_[iCol], false);
     } else {
       assert(!default_bounds);
       // Non-default bound
       if (lp.col_lower_[iCol] != 0) {
         // Nonzero lower bound
-        this->writeToFileValue(file, lp.col_lower_[iCol], false);
-        this->writeToFile(file, " <=");
+        this->writeToFileValue(out, lp.col_lower_[iCol], false);
+        this->writeToFile(out, " <=");
       }
       if (has_col_names) {
-        this->writeToFileVar(file, lp.col_names_[iCol]);
+        this->writeToFileVar(out, lp.col_names_[iCol]);
       } else {
-        this->writeToFileVar(file, iCol);
+        this->writeToFileVar(out, iCol);
       }
       if (lp.col_upper_[iCol] < kHighsInf) {
         // Finite upper bound
-        this->writeToFile(file, " <=");
-        this->writeToFileValue(file, lp.col_upper_[iCol], false);
+        this->writeToFile(out, " <=");
+        this->writeToFileValue(out, lp.col_upper_[iCol], false);
       }
     }
-    this->writeToFileLineend(file);
+    this->writeToFileLineend(out);
   }
   if (lp.integrality_.size() > 0) {
     // write binary section
-    this->writeToFile(file, "bin");
-    this->writeToFileLineend(file);
+    this->writeToFile(out, "bin");
+    this->writeToFileLineend(out);
     for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
       if (lp.integrality_[iCol] == HighsVarType::kInteger) {
         if (lp.col_lower_[iCol] == 0.0 && lp.col_upper_[iCol] == 1.0) {
           if (has_col_names) {
-            this->writeToFileVar(file, lp.col_names_[iCol]);
+            this->writeToFileVar(out, lp.col_names_[iCol]);
           } else {
-            this->writeToFileVar(file, iCol);
+            this->writeToFileVar(out, iCol);
           }
-          this->writeToFileLineend(file);
+          this->writeToFileLineend(out);
         }
       }
     }
 
     // write general section
-    this->writeToFile(file, "gen");
-    this->writeToFileLineend(file);
+    this->writeToFile(out, "gen");
+    this->writeToFileLineend(out);
     for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
       if (lp.integrality_[iCol] == HighsVarType::kInteger) {
         if (lp.col_lower_[iCol] != 0.0 || lp.col_upper_[iCol] != 1.0) {
           if (has_col_names) {
-            this->writeToFileVar(file, lp.col_names_[iCol]);
+            this->writeToFileVar(out, lp.col_names_[iCol]);
           } else {
-            this->writeToFileVar(file, iCol);
+            this->writeToFileVar(out, iCol);
           }
-          this->writeToFileLineend(file);
+          this->writeToFileLineend(out);
         }
       }
     }
 
     // write semi section
-    this->writeToFile(file, "semi");
-    this->writeToFileLineend(file);
+    this->writeToFile(out, "semi");
+    this->writeToFileLineend(out);
     for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
       if (lp.integrality_[iCol] == HighsVarType::kSemiContinuous ||
           lp.integrality_[iCol] == HighsVarType::kSemiInteger) {
         if (has_col_names) {
-          this->writeToFileVar(file, lp.col_names_[iCol]);
+          this->writeToFileVar(out, lp.col_names_[iCol]);
         } else {
-          this->writeToFileVar(file, iCol);
+          this->writeToFileVar(out, iCol);
         }
-        this->writeToFileLineend(file);
+        this->writeToFileLineend(out);
       }
     }
   }
   // write end
-  this->writeToFile(file, "end");
-  this->writeToFileLineend(file);
-
-  fclose(file);
+  this->writeToFile(out, "end");
+  this->writeToFileLineend(out);
+
+  file.write(out.text);
+  if (!file.close()) {
+    highsLogUser(options.log_options, HighsLogType::kError,
+                 "Error writing file %s\n", filename.c_str());
+    return HighsStatus::kError;
+  }
   return HighsStatus::kOk;
 }
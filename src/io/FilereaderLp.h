@@ -37,18 +37,26 @@ class FilereaderLp : public Filereader {
                                const HighsModel& model);
 
  private:
-  // functions to write files
-  HighsInt linelength;
-  void writeToFile(FILE* file, const char* format, ...);
-  void writeToFileLineend(FILE* file);
-  void writeToFileValue(FILE* file, const double value,
+  // functions to write files, appending to text whose current line
+  // has length linelength
+  struct LpText {
+    std::string text;
+    HighsInt linelength = 0;
+  };
+  void writeToFile(LpText& out, const char* format, ...);
+  void writeToFileLineend(LpText& out);
+  void writeToFileValue(LpText& out, const double value,
                         const bool force_plus = true);
-  void writeToFileVar(FILE* file, const HighsInt var_index);
-  void writeToFileVar(FILE* file, const std::string var_name);
-  void writeToFileCon(FILE* file, const HighsInt con_index);
-  void writeToFileMatrixRow(FILE* file, const HighsInt iRow,
-                            const HighsSparseMatrix ar_matrix,
-                            const std::vector<string> col_names);
+  void writeToFileVar(LpText& out, const HighsInt var_index);
+  void writeToFileVar(LpText& out, const std::string& var_name);
+  void writeToFileCon(LpText& out, const HighsInt con_index);
+  void writeToFileMatrixRow(LpText& out, const HighsInt iRow,
+                            const HighsSparseMatrix& ar_matrix,
+                            const std::vector<string>& col_names);
+  void writeToFileRows(LpText& out, const HighsInt from_row,
+                       const HighsInt to_row, const HighsLp& lp,
+                       const HighsSparseMatrix& ar_matrix,
+                       const bool has_row_names);
 };
 
 #endif
@@ -16,6 +16,7 @@
 #include <algorithm>
 #include <cstdio>
 
+#include "io/HighsTextWriter.h"
 #include "lp_data/HConst.h"
 #include "lp_data/HighsLp.h"
 #include "lp_data/HighsModelUtils.h"
@@ -616,8 +617,8 @@ HighsStatus writeMps(
   HighsInt num_no_cost_zero_columns_in_bounds_section = 0;
   highsLogDev(log_options, HighsLogType::kInfo,
               "writeMPS: Trying to open file %s\n", filename.c_str());
-  FILE* file = fopen(filename.c_str(), "w");
-  if (file == 0) {
+  HighsTextWriter file;
+  if (!file.open(filename)) {
     highsLogUser(log_options, HighsLogType::kError, "Cannot open file %s\n",
                  filename.c_str());
     return HighsStatus::kError;
@@ -633,7 +634,6 @@ HighsStatus writeMps(
         "Cannot write fixed MPS with names of length (up to) %" HIGHSINT_FORMAT
         "\n",
         max_name_length);
-    fclose(file);
     return HighsStatus::kError;
   }
   assert(objective_name != "");
@@ -754,101 +754,138 @@ HighsStatus writeMps(
   // The free format reader thought that it had a name of "1      1" containing
   // spaces.
 
-  fprintf(file, "NAME        %s\n", model_name.c_str());
+  file.print("NAME        %s\n", model_name.c_str());
   const bool use_objsense = true;
   const HighsInt use_sense = use_objsense ? 1 : (HighsInt)sense;
-  if (sense == ObjSense::kMaximize) fprintf(file, "OBJSENSE\n  MAX\n");
-  fprintf(file, "ROWS\n");
-  fprintf(file, " N  %-8s\n", objective_name.c_str());
+  if (sense == ObjSense::kMaximize) file.print("OBJSENSE\n  MAX\n");
+  file.print("ROWS\n");
+  file.print(" N  %-8s\n", objective_name.c_str());
   for (HighsInt r_n = 0; r_n < num_row; r_n++) {
     if (r_ty[r_n] == MPS_ROW_TY_E) {
-      fprintf(file, " E  %-8s\n", row_names[r_n].c_str());
+      file.print(" E  %-8s\n", row_names[r_n].c_str());
     } else if (r_ty[r_n] == MPS_ROW_TY_G) {
-      fprintf(file, " G  %-8s\n", row_names[r_n].c_str());
+      file.print(" G  %-8s\n", row_names[r_n].c_str());
     } else if (r_ty[r_n] == MPS_ROW_TY_L) {
-      fprintf(file, " L  %-8s\n", row_names[r_n].c_str());
+      file.print(" L  %-8s\n", row_names[r_n].c_str());
     } else {
-      fprintf(file, " N  %-8s\n", row_names[r_n].c_str());
+      file.print(" N  %-8s\n", row_names[r_n].c_str());
     }
   }
+  file.print("COLUMNS\n");
+  const bool write_no_cost_zero_columns = true;
+  // The COLUMNS section has a line for each nonzero, so it is formatted
+  // in blocks of columns with roughly kBlockNz entries. A first pass
+  // records the integer marker state at the start of each block
+  const HighsInt kBlockNz = 1 << 16;
+  std::vector<HighsInt> block_start;
+  std::vector<bool> block_integerFg;
+  std::vector<HighsInt> block_nIntegerMk;
   bool integerFg = false;
   HighsInt nIntegerMk = 0;
-  fprintf(file, "COLUMNS\n");
-  const bool write_no_cost_zero_columns = true;
+  HighsInt block_nz = kBlockNz;
   for (HighsInt c_n = 0; c_n < num_col; c_n++) {
+    if (block_nz >= kBlockNz) {
+      block_start.push_back(c_n);
+      block_integerFg.push_back(integerFg);
+      block_nIntegerMk.push_back(nIntegerMk);
+      block_nz = 0;
+    }
+    block_nz += 1 + a_start[c_n + 1] - a_start[c_n];
     const bool no_cost_zero_column =
         !col_cost[c_n] && a_start[c_n] == a_start[c_n + 1];
     if (no_cost_zero_column) {
-      // Possibly skip this column as it's zero and has no cost
       num_no_cost_zero_columns++;
-      if (write_no_cost_zero_columns) {
-        // Give the column a presence by writing out a zero cost
-        fprintf(file, "    %-8s  %-8s  %.10g\n", col_names[c_n].c_str(),
-                objective_name.c_str(), 0.0);
-      }
       continue;
     }
     if (have_int) {
-      if (integrality[c_n] == HighsVarType::kInteger && !integerFg) {
-        // Start an integer section
-        fprintf(file,
-                "    MARK%04" HIGHSINT_FORMAT
-                "  'MARKER'                 'INTORG'\n",
-                nIntegerMk++);
-        integerFg = true;
-      } else if (integrality[c_n] != HighsVarType::kInteger && integerFg) {
-        // End an integer section
-        fprintf(file,
-                "    MARK%04" HIGHSINT_FORMAT
-                "  'MARKER'                 'INTEND'\n",
-                nIntegerMk++);
-        integerFg = false;
+      const bool is_integer = integrality[c_n] == HighsVarType::kInteger;
+      if (is_integer != integerFg) {
+        nIntegerMk++;
+        integerFg = is_integer;
       }
     }
-    if (col_cost[c_n] != 0) {
-      double v = use_sense * col_cost[c_n];
-      fprintf(file, "    %-8s  %-8s  %.10g\n", col_names[c_n].c_str(),
-              objective_name.c_str(), v);
-    }
-    for (HighsInt el_n = a_start[c_n]; el_n < a_start[c_n + 1]; el_n++) {
-      double v = a_value[el_n];
-      HighsInt r_n = a_index[el_n];
-      fprintf(file, "    %-8s  %-8s  %.10g\n", col_names[c_n].c_str(),
-              row_names[r_n].c_str(), v);
-    }
   }
+  const HighsInt num_block = block_start.size();
+  block_start.push_back(num_col);
+  auto formatColumns = [&](const HighsInt block, std::string& text) {
+    bool integerFg = block_integerFg[block];
+    HighsInt nIntegerMk = block_nIntegerMk[block];
+    for (HighsInt c_n = block_start[block]; c_n < block_start[block + 1];
+         c_n++) {
+      const bool no_cost_zero_column =
+          !col_cost[c_n] && a_start[c_n] == a_start[c_n + 1];
+      if (no_cost_zero_column) {
+        // Possibly skip this column as it's zero and has no cost
+        if (write_no_cost_zero_columns) {
+          // Give the column a presence by writing out a zero cost
+          highsAppendFormat(text, "    %-8s  %-8s  %.10g\n",
+                            col_names[c_n].c_str(), objective_name.c_str(),
+                            0.0);
+        }
+        continue;
+      }
+      if (have_int) {
+        if (integrality[c_n] == HighsVarType::kInteger && !integerFg) {
+          // Start an integer section
+          highsAppendFormat(text,
+                            "    MARK%04" HIGHSINT_FORMAT
+                            "  'MARKER'                 'INTORG'\n",
+                            nIntegerMk++);
+          integerFg = true;
+        } else if (integrality[c_n] != HighsVarType::kInteger && integerFg) {
+          // End an integer section
+          highsAppendFormat(text,
+                            "    MARK%04" HIGHSINT_FORMAT
+                            "  'MARKER'                 'INTEND'\n",
+                            nIntegerMk++);
+          integerFg = false;
+        }
+      }
+      if (col_cost[c_n] != 0) {
+        double v = use_sense * col_cost[c_n];
+        highsAppendFormat(text, "    %-8s  %-8s  %.10g\n",
+                          col_names[c_n].c_str(), objective_name.c_str(), v);
+      }
+      for (HighsInt el_n = a_start[c_n]; el_n < a_start[c_n + 1]; el_n++) {
+        double v = a_value[el_n];
+        HighsInt r_n = a_index[el_n];
+        highsAppendFormat(text, "    %-8s  %-8s  %.10g\n",
+                          col_names[c_n].c_str(), row_names[r_n].c_str(), v);
+      }
+    }
+  };
+  file.writeBlocks(num_block, formatColumns);
   // End any integer section
   if (integerFg)
-    fprintf(file,
-            "    MARK%04" HIGHSINT_FORMAT
-            "  'MARKER'                 'INTEND'\n",
-            nIntegerMk++);
+    file.print("    MARK%04" HIGHSINT_FORMAT
+               "  'MARKER'                 'INTEND'\n",
+               nIntegerMk++);
   have_rhs = true;
   if (have_rhs) {
-    fprintf(file, "RHS\n");
+    file.print("RHS\n");
     if (offset) {
       // Handle the objective offset as a RHS entry for the cost row
       double v = -use_sense * offset;
-      fprintf(file, "    RHS_V     %-8s  %.10g\n", objective_name.c_str(), v);
+      file.print("    RHS_V     %-8s  %.10g\n", objective_name.c_str(), v);
     }
     for (HighsInt r_n = 0; r_n < num_row; r_n++) {
       double v = rhs[r_n];
       if (v) {
-        fprintf(file, "    RHS_V     %-8s  %.10g\n", row_names[r_n].c_str(), v);
+        file.print("    RHS_V     %-8s  %.10g\n", row_names[r_n].c_str(), v);
       }
     }
   }
   if (have_ranges) {
-    fprintf(file, "RANGES\n");
+    file.print("RANGES\n");
     for (HighsInt r_n = 0; r_n < num_row; r_n++) {
       double v = ranges[r_n];
       if (v) {
-        fprintf(file, "    RANGE     %-8s  %.10g\n", row_names[r_n].c_str(), v);
+        file.print("    RANGE     %-8s  %.10g\n", row_names[r_n].c_str(), v);
       }
     }
   }
   if (have_bounds) {
-    fprintf(file, "BOUNDS\n");
+    file.print("BOUNDS\n");
     for (HighsInt c_n = 0; c_n < num_col; c_n++) {
       double lb = col_lower[c_n];
       double ub = col_upper[c_n];
@@ -869,11 +906,11 @@ HighsStatus writeMps(
       }
       if (lb == ub) {
         // Equal lower and upper bounds: Fixed
-        fprintf(file, " FX BOUND     %-8s  %.10g\n", col_names[c_n].c_str(),
-                lb);
+        file.print(" FX BOUND     %-8s  %.10g\n", col_names[c_n].c_str(),
+             lb);
       } else if (highs_isInfinity(-lb) && highs_isInfinity(ub)) {
         // Infinite lower and upper bounds: Free
-        fprintf(file, " FR BOUND     %-8s\n", col_names[c_n].c_str());
+        file.print(" FR BOUND     %-8s\n", col_names[c_n].c_str());
       } else {
         if (discrete) {
           // Warn if writing non-integer bounds for integer or semi-integer
@@ -902,19 +939,19 @@ HighsStatus writeMps(
           if (integrality[c_n] == HighsVarType::kInteger) {
             if (lb == 0 && ub == 1) {
               // Binary
-              fprintf(file, " BV BOUND     %-8s\n", col_names[c_n].c_str());
+              file.print(" BV BOUND     %-8s\n", col_names[c_n].c_str());
             } else {
               if (!highs_isInfinity(-lb)) {
                 // Finite lower bound. No need to state this if LB is
                 // zero unless UB is infinite
                 if (lb || highs_isInfinity(ub))
-                  fprintf(file, " LI BOUND     %-8s  %.10g\n",
-                          col_names[c_n].c_str(), lb);
+                  file.print(" LI BOUND     %-8s  %.10g\n",
+                       col_names[c_n].c_str(), lb);
               }
               if (!highs_isInfinity(ub)) {
                 // Finite upper bound
-                fprintf(file, " UI BOUND     %-8s  %.10g\n",
-                        col_names[c_n].c_str(), ub);
+                file.print(" UI BOUND     %-8s  %.10g\n",
+                     col_names[c_n].c_str(), ub);
               }
             }
           } else if (integrality[c_n] == HighsVarType::kSemiInteger ||
@@ -941,32 +978,32 @@ HighsStatus writeMps(
                   log_options, HighsLogType::kWarning,
                   "Upper bound for semi-variable \"%s\" is %g but writing %g\n",
                   col_names[c_n].c_str(), ub, use_ub);
-            fprintf(file, " LO BOUND     %-8s  %.10g\n", col_names[c_n].c_str(),
-                    use_lb);
+            file.print(" LO BOUND     %-8s  %.10g\n", col_names[c_n].c_str(),
+                 use_lb);
             if (integrality[c_n] == HighsVarType::kSemiInteger) {
-              fprintf(file, " SI BOUND     %-8s  %.10g\n",
-                      col_names[c_n].c_str(), use_ub);
+              file.print(" SI BOUND     %-8s  %.10g\n",
+                   col_names[c_n].c_str(), use_ub);
             } else {
               // Semi-continuous
-              fprintf(file, " SC BOUND     %-8s  %.10g\n",
-                      col_names[c_n].c_str(), use_ub);
+              file.print(" SC BOUND     %-8s  %.10g\n",
+                   col_names[c_n].c_str(), use_ub);
             }
           }
         } else {
           if (!highs_isInfinity(-lb)) {
             // Lower bounded variable - default is 0
             if (lb) {
-              fprintf(file, " LO BOUND     %-8s  %.10g\n",
-                      col_names[c_n].c_str(), lb);
+              file.print(" LO BOUND     %-8s  %.10g\n",
+                   col_names[c_n].c_str(), lb);
             }
           } else {
             // Infinite lower bound
-            fprintf(file, " MI BOUND     %-8s\n", col_names[c_n].c_str());
+            file.print(" MI BOUND     %-8s\n", col_names[c_n].c_str());
           }
           if (!highs_isInfinity(ub)) {
             // Upper bounded variable
-            fprintf(file, " UP BOUND     %-8s  %.10g\n", col_names[c_n].c_str(),
-                    ub);
+            file.print(" UP BOUND     %-8s  %.10g\n", col_names[c_n].c_str(),
+                 ub);
           }
         }
       }
@@ -979,19 +1016,19 @@ HighsStatus writeMps(
     assert((HighsInt)q_value.size() >= q_start[q_dim]);
 
     // Assumes that Hessian entries are the lower triangle column-wise
-    fprintf(file, "QUADOBJ\n");
+    file.print("QUADOBJ\n");
     for (HighsInt col = 0; col < q_dim; col++) {
       for (HighsInt el = q_start[col]; el < q_start[col + 1]; el++) {
         HighsInt row = q_index[el];
         assert(row >= col);
         // May have explicit zeroes on the diagonal
         if (q_value[el])
-          fprintf(file, "    %-8s  %-8s  %.10g\n", col_names[col].c_str(),
-                  col_names[row].c_str(), use_sense * q_value[el]);
+          file.print("    %-8s  %-8s  %.10g\n", col_names[col].c_str(),
+               col_names[row].c_str(), use_sense * q_value[el]);
       }
     }
   }
-  fprintf(file, "ENDATA\n");
+  file.print("ENDATA\n");
   if (num_no_cost_zero_columns)
     highsLogUser(log_options, HighsLogType::kInfo,
                  "Model has %" HIGHSINT_FORMAT
@@ -1001,6 +1038,10 @@ HighsStatus writeMps(
                  num_no_cost_zero_columns,
                  num_no_cost_zero_columns_in_bounds_section,
                  write_no_cost_zero_columns ? "" : "not ");
-  fclose(file);
+  if (!file.close()) {
+    highsLogUser(log_options, HighsLogType::kError,
+                 "Error writing file %s\n", filename.c_str());
+    return HighsStatus::kError;
+  }
   return HighsStatus::kOk;
 }
@@ -430,13 +430,13 @@ HMpsFF::Parsekey HMpsFF::checkFirstWord(std::string& strline, size_t& start,
 
 HighsInt HMpsFF::getColIdx(const std::string& colname, const bool add_if_new) {
   // look up column name
-  auto mit = colname2idx.find(colname);
-  if (mit != colname2idx.end()) return mit->second;
+  const int* mit = colname2idx.find(colname);
+  if (mit != nullptr) return *mit;
 
   if (!add_if_new) return -1;
   // add new continuous column with default bounds
-  colname2idx.emplace(colname, num_col++);
-  col_names.push_back(colname);
+  colname2idx.insert(colname, num_col++);
+  if (keep_names) col_names.push_back(colname);
   col_integrality.push_back(HighsVarType::kContinuous);
   col_binary.push_back(false);
   col_lower.push_back(0.0);
@@ -553,7 +553,7 @@ HMpsFF::Parsekey HMpsFF::parseRows(const HighsLogOptions& log_options,
       if (!hasobj) {
         highsLogUser(log_options, HighsLogType::kWarning,
                      "No objective row found\n");
-        rowname2idx.emplace("artificial_empty_objective", -1);
+        rowname2idx.insert("artificial_empty_objective", -1);
       };
       return key;
     }
@@ -602,31 +602,31 @@ HMpsFF::Parsekey HMpsFF::parseRows(const HighsLogOptions& log_options,
 
     // Do not add to matrix if row is free.
     if (isFreeRow) {
-      rowname2idx.emplace(rowname, -2);
+      rowname2idx.insert(rowname, -2);
       continue;
     }
 
     // so in rowname2idx -1 is the objective, -2 is all the free rows
-    auto ret = rowname2idx.emplace(rowname, isobj ? (-1) : (num_row++));
-    // ret is a pair consisting of an iterator to the inserted
-    // element (or the already-existing element if no insertion
-    // happened) and a bool denoting whether the insertion took place
+    // inserted is false if the name is already in rowname2idx
+    const bool inserted =
+        rowname2idx.insert(rowname, isobj ? (-1) : (num_row++));
 
     // Else is enough here because all free rows are ignored.
-    if (!isobj)
-      row_names.push_back(rowname);
-    else
+    if (!isobj) {
+      if (keep_names) row_names.push_back(rowname);
+    } else {
       objective_name = rowname;
+    }
 
-    if (!ret.second) {
+    if (!inserted) {
       // Duplicate row name
       if (!has_duplicate_row_name_) {
         // This is the first so record it
         has_duplicate_row_name_ = true;
-        auto mit = rowname2idx.find(rowname);
-        assert(mit != rowname2idx.end());
+        const int* mit = rowname2idx.find(rowname);
+        assert(mit != nullptr);
         duplicate_row_name_ = rowname;
-        duplicate_row_name_index0_ = mit->second;
+        duplicate_row_name_index0_ = *mit;
         duplicate_row_name_index1_ = num_row - 1;
       }
     }
@@ -658,11 +658,10 @@ typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
   col_value.assign(num_row, 0);
   col_index.resize(num_row);
 
-  auto parseName = [&rowidx, this](std::string name) {
-    auto mit = rowname2idx.find(name);
-
-    assert(mit != rowname2idx.end());
-    rowidx = mit->second;
+  // The row has already been found in rowname2idx
+  auto parseName = [&rowidx, this](const int* mit) {
+    assert(mit != nullptr);
+    rowidx = *mit;
 
     if (rowidx >= 0)
       this->num_nz++;
@@ -743,8 +742,8 @@ typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
     // with spaces. Best bet is to see whether "marker" is in the set
     // of row names. If it is, then assume that the names are short
     if (end_marker < 9) {
-      auto mit = rowname2idx.find(marker);
-      if (mit == rowname2idx.end()) {
+      const int* mit = rowname2idx.find(marker);
+      if (mit == nullptr) {
         // marker is not a row name, so continue to look at name
         std::string name = strline.substr(0, 10);
         // Delete trailing spaces
@@ -784,17 +783,17 @@ typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
       }
       assert(!col_cost);
       colname = word;
-      auto ret = colname2idx.emplace(colname, num_col++);
-      col_names.push_back(colname);
-      if (!ret.second) {
+      const bool inserted = colname2idx.insert(colname, num_col++);
+      if (keep_names) col_names.push_back(colname);
+      if (!inserted) {
         // Duplicate col name
         if (!has_duplicate_col_name_) {
           // This is the first so record it
           has_duplicate_col_name_ = true;
-          auto mit = colname2idx.find(colname);
-          assert(mit != colname2idx.end());
+          const int* mit = colname2idx.find(colname);
+          assert(mit != nullptr);
           duplicate_col_name_ = colname;
-          duplicate_col_name_index0_ = mit->second;
+          duplicate_col_name_index0_ = *mit;
           duplicate_col_name_index1_ = num_col - 1;
         }
       }
@@ -825,8 +824,8 @@ typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
       return HMpsFF::Parsekey::kFail;
     }
 
-    auto mit = rowname2idx.find(marker);
-    if (mit == rowname2idx.end()) {
+    const int* mit = rowname2idx.find(marker);
+    if (mit == nullptr) {
       highsLogUser(
           log_options, HighsLogType::kWarning,
           "Row name \"%s\" in COLUMNS section is not defined: ignored\n",
@@ -840,7 +839,7 @@ typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
         return HMpsFF::Parsekey::kFail;
       }
       if (value) {
-        parseName(marker);  // rowidx set and num_nz incremented
+        parseName(mit);  // rowidx set and num_nz incremented
         if (rowidx >= 0) {
           if (col_value[rowidx]) {
             // Ignore duplicate entry
@@ -885,8 +884,8 @@ typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
 
       assert(is_end(strline, end));
 
-      auto mit = rowname2idx.find(marker);
-      if (mit == rowname2idx.end()) {
+      const int* mit = rowname2idx.find(marker);
+      if (mit == nullptr) {
         highsLogUser(
             log_options, HighsLogType::kWarning,
             "Row name \"%s\" in COLUMNS section is not defined: ignored\n",
@@ -901,7 +900,7 @@ typename HMpsFF::Parsekey HMpsFF::parseCols(const HighsLogOptions& log_options,
         return HMpsFF::Parsekey::kFail;
       }
       if (value) {
-        parseName(marker);  // rowidx set and num_nz incremented
+        parseName(mit);  // rowidx set and num_nz incremented
         if (rowidx >= 0) {
           if (col_value[rowidx]) {
             // Ignore duplicate entry
@@ -936,10 +935,10 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
 
   auto parseName = [this](const std::string& name, HighsInt& rowidx,
                           bool& has_entry) {
-    auto mit = rowname2idx.find(name);
+    const int* mit = rowname2idx.find(name);
 
-    assert(mit != rowname2idx.end());
-    rowidx = mit->second;
+    assert(mit != nullptr);
+    rowidx = *mit;
 
     assert(rowidx < num_row);
 
@@ -1009,7 +1008,7 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
     // Ignore lack of name for SIF format;
     // we know we have this case when "word" is a row name
     if ((key == Parsekey::kNone) && (key != Parsekey::kRhs) &&
-        (rowname2idx.find(word) != rowname2idx.end())) {
+        (rowname2idx.find(word) != nullptr)) {
       end = begin;
     }
 
@@ -1030,13 +1029,13 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
       return HMpsFF::Parsekey::kFail;
     }
 
-    auto mit = rowname2idx.find(marker);
+    const int* mit = rowname2idx.find(marker);
 
     // SIF format sometimes has the name of the MPS file
     // prepended to the RHS entry; remove it here if
     // that's the case. "word" will then hold the marker,
     // so also get new "word" and "end" values
-    if (mit == rowname2idx.end()) {
+    if (mit == nullptr) {
       if (marker == mps_name) {
         marker = word;
         end_marker = end;
@@ -1053,7 +1052,7 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
       }
     }
 
-    if (mit == rowname2idx.end()) {
+    if (mit == nullptr) {
       highsLogUser(log_options, HighsLogType::kWarning,
                    "Row name \"%s\" in RHS section is not defined: ignored\n",
                    marker.c_str());
@@ -1096,8 +1095,8 @@ HMpsFF::Parsekey HMpsFF::parseRhs(const HighsLogOptions& log_options,
 
       assert(is_end(strline, end));
 
-      auto mit = rowname2idx.find(marker);
-      if (mit == rowname2idx.end()) {
+      const int* mit = rowname2idx.find(marker);
+      if (mit == nullptr) {
         highsLogUser(log_options, HighsLogType::kWarning,
                      "Row name \"%s\" in RHS section is not defined: ignored\n",
                      marker.c_str());
@@ -1276,7 +1275,7 @@ HMpsFF::Parsekey HMpsFF::parseBounds(const HighsLogOptions& log_options,
 
     std::string marker;
     size_t end_marker;
-    if (colname2idx.find(bound_name) != colname2idx.end()) {
+    if (colname2idx.find(bound_name) != nullptr) {
       // SIF format might not have the bound name, so skip
       // it here if we found the marker instead
       marker = bound_name;
@@ -1398,10 +1397,10 @@ HMpsFF::Parsekey HMpsFF::parseRanges(const HighsLogOptions& log_options,
   std::string strline, word;
 
   auto parseName = [this](const std::string& name, HighsInt& rowidx) {
-    auto mit = rowname2idx.find(name);
+    const int* mit = rowname2idx.find(name);
 
-    assert(mit != rowname2idx.end());
-    rowidx = mit->second;
+    assert(mit != nullptr);
+    rowidx = *mit;
 
     assert(rowidx < num_row);
   };
@@ -1466,8 +1465,8 @@ HMpsFF::Parsekey HMpsFF::parseRanges(const HighsLogOptions& log_options,
       return HMpsFF::Parsekey::kFail;
     }
 
-    auto mit = rowname2idx.find(marker);
-    if (mit == rowname2idx.end()) {
+    const int* mit = rowname2idx.find(marker);
+    if (mit == nullptr) {
       highsLogUser(
           log_options, HighsLogType::kWarning,
           "Row name \"%s\" in RANGES section is not defined: ignored\n",
@@ -1512,8 +1511,8 @@ HMpsFF::Parsekey HMpsFF::parseRanges(const HighsLogOptions& log_options,
         return HMpsFF::Parsekey::kFail;
       }
 
-      auto mit = rowname2idx.find(marker);
-      if (mit == rowname2idx.end()) {
+      const int* mit = rowname2idx.find(marker);
+      if (mit == nullptr) {
         highsLogUser(
             log_options, HighsLogType::kWarning,
             "Row name \"%s\" in RANGES section is not defined: ignored\n",
@@ -1694,10 +1693,10 @@ typename HMpsFF::Parsekey HMpsFF::parseQuadRows(
     return HMpsFF::Parsekey::kFail;
   }
 
-  auto mit = rowname2idx.find(rowname);
+  const int* mit = rowname2idx.find(rowname);
   // if row of section does not exist or is free (index -2), then skip
-  if (mit == rowname2idx.end() || mit->second == -2) {
-    if (mit == rowname2idx.end())
+  if (mit == nullptr || *mit == -2) {
+    if (mit == nullptr)
       highsLogUser(log_options, HighsLogType::kWarning,
                    "Row name \"%s\" in %s section is not defined: ignored\n",
                    rowname.c_str(), section_name.c_str());
@@ -1716,7 +1715,7 @@ typename HMpsFF::Parsekey HMpsFF::parseQuadRows(
     }
     return Parsekey::kFail;  // unexpected end of file
   }
-  rowidx = mit->second;
+  rowidx = *mit;
   assert(rowidx >= -1);
   assert(rowidx < num_row);
 
@@ -27,13 +27,13 @@
 #include <map>
 #include <memory>
 #include <tuple>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include "io/HighsIO.h"
 #include "model/HighsModel.h"
 // #include "util/HighsInt.h"
+#include "util/HighsNameTable.h"
 #include "util/stringutil.h"
 
 using Triplet = std::tuple<HighsInt, HighsInt, double>;
@@ -62,6 +62,8 @@ class HMpsFF {
                                          HighsModel& model);
 
   double time_limit = kHighsInf;
+  // Whether the row and column names are stored in the model
+  bool keep_names = true;
 
  private:
   double start_time;
@@ -184,8 +186,8 @@ class HMpsFF {
   std::vector<ConeType> cone_type;
   std::vector<double> cone_param;
   std::vector<std::vector<HighsInt>> cone_entries;
-  std::unordered_map<std::string, int> rowname2idx;
-  std::unordered_map<std::string, int> colname2idx;
+  HighsNameTable rowname2idx;
+  HighsNameTable colname2idx;
 
   mutable std::string section_args;
 
@@ -0,0 +1,151 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/HighsTextWriter.cpp
+ * @brief Buffered writing of text files, formatted in parallel blocks
+ */
+#include "io/HighsTextWriter.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <vector>
+
+#include "HConfig.h"
+#include "parallel/HighsParallel.h"
+
+#ifdef ZLIB_FOUND
+#include "../extern/zstr/zstr.hpp"
+#endif
+
+// Text is passed to the file once this much has been buffered
+const size_t kTextWriterBufferSize = 1 << 20;
+
+void highsAppendFormatV(std::string& text, const char* format,
+                        va_list argptr) {
+  va_list argptr_copy;
+  va_copy(argptr_copy, argptr);
+  char local[256];
+  int len = vsnprintf(local, sizeof(local), format, argptr);
+  if (len < (int)sizeof(local)) {
+    if (len > 0) text.append(local, len);
+  } else {
+    // Too long for the local buffer, so format straight into the text
+    const size_t size = text.size();
+    text.resize(size + len + 1);
+    vsnprintf(&text[size], len + 1, format, argptr_copy);
+    text.resize(size + len);
+  }
+  va_end(argptr_copy);
+}
+
+void highsAppendFormat(std::string& text, const char* format, ...) {
+  va_list argptr;
+  va_start(argptr, format);
+  highsAppendFormatV(text, format, argptr);
+  va_end(argptr);
+}
+
+bool HighsTextWriter::open(const std::string& filename) {
+  const bool compress = filename.size() > 3 &&
+                        filename.compare(filename.size() - 3, 3, ".gz") == 0;
+  ok_ = true;
+  buffer_.clear();
+#ifdef ZLIB_FOUND
+  if (compress) {
+    try {
+      stream_.reset(new zstr::ofstream(filename, std::ios::out));
+    } catch (const strict_fstream::Exception&) {
+      stream_.reset();
+      return false;
+    }
+    return true;
+  }
+#else
+  (void)compress;
+#endif
+  std::ofstream* file = new std::ofstream(filename, std::ios::out);
+  stream_.reset(file);
+  if (!file->is_open()) {
+    stream_.reset();
+    return false;
+  }
+  return true;
+}
+
+void HighsTextWriter::print(const char* format, ...) {
+  va_list argptr;
+  va_start(argptr, format);
+  highsAppendFormatV(buffer_, format, argptr);
+  va_end(argptr);
+  if (buffer_.size() >= kTextWriterBufferSize) flushBuffer();
+}
+
+void HighsTextWriter::write(const std::string& text) {
+  buffer_ += text;
+  if (buffer_.size() >= kTextWriterBufferSize) flushBuffer();
+}
+
+void HighsTextWriter::flushBuffer() {
+  if (stream_ && !buffer_.empty())
+    stream_->write(buffer_.data(), buffer_.size());
+  buffer_.clear();
+}
+
+void HighsTextWriter::writeBlocks(
+    const HighsInt num_block,
+    const std::function<void(HighsInt, std::string&)>& formatBlock) {
+  flushBuffer();
+  if (num_block <= 0 || !stream_) return;
+  // Without a scheduler, the blocks are formatted and written in turn
+  if (HighsTaskExecutor::getThisWorkerDeque() == nullptr) {
+    std::string text;
+    for (HighsInt block = 0; block < num_block; block++) {
+      text.clear();
+      formatBlock(block, text);
+      stream_->write(text.data(), text.size());
+    }
+    return;
+  }
+  const HighsInt round_size = 4 * highs::parallel::num_threads();
+  auto formatRound = [&](const HighsInt first, std::vector<std::string>& text) {
+    const HighsInt count = std::min(round_size, num_block - first);
+    text.resize(count);
+    highs::parallel::for_each(0, count, [&](HighsInt start, HighsInt end) {
+      for (HighsInt k = start; k < end; k++) {
+        text[k].clear();
+        formatBlock(first + k, text[k]);
+      }
+    });
+  };
+  std::vector<std::string> text;
+  std::vector<std::string> next_text;
+  formatRound(0, text);
+  for (HighsInt first = 0; first < num_block; first += round_size) {
+    const HighsInt next_first = first + round_size;
+    highs::parallel::TaskGroup tg;
+    if (next_first < num_block)
+      tg.spawn([&]() { formatRound(next_first, next_text); });
+    for (const std::string& block_text : text)
+      stream_->write(block_text.data(), block_text.size());
+    tg.taskWait();
+    std::swap(text, next_text);
+  }
+}
+
+bool HighsTextWriter::close() {
+  if (!stream_) return ok_;
+  flushBuffer();
+  stream_->flush();
+  ok_ = bool(*stream_) && ok_;
+  // Destroying the stream closes the file, completing any compression
+  stream_.reset();
+  return ok_;
+}
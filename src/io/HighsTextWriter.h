@@ -0,0 +1,67 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file io/HighsTextWriter.h
+ * @brief Buffered writing of text files, formatted in parallel blocks
+ */
+#ifndef IO_HIGHS_TEXT_WRITER_H_
+#define IO_HIGHS_TEXT_WRITER_H_
+
+#include <cstdarg>
+#include <functional>
+#include <memory>
+#include <ostream>
+#include <string>
+
+#include "util/HighsInt.h"
+
+// Appends printf-style formatted text to a string
+void highsAppendFormat(std::string& text, const char* format, ...);
+void highsAppendFormatV(std::string& text, const char* format,
+                        va_list argptr);
+
+// Writes a text file through a buffer. If the file name ends in .gz
+// and HiGHS is built with zlib, the file is compressed.
+//
+// Large sections of a file, such as those with an entry for each
+// nonzero, are formatted as blocks of text in parallel, and written in
+// order. While one round of blocks is being written (and compressed),
+// the next round is formatted, so memory use is bounded and the
+// formatting and writing overlap.
+class HighsTextWriter {
+ public:
+  ~HighsTextWriter() { close(); }
+
+  // Returns false if the file cannot be opened
+  bool open(const std::string& filename);
+
+  void print(const char* format, ...);
+  void write(const std::string& text);
+
+  // Calls formatBlock(block, text) for each of the num_block blocks,
+  // writing the text of the blocks in order. Each call must only
+  // depend on its block, since calls may run concurrently
+  void writeBlocks(
+      const HighsInt num_block,
+      const std::function<void(HighsInt, std::string&)>& formatBlock);
+
+  // Flushes and closes the file, returning false if there has been an
+  // error writing it
+  bool close();
+
+ private:
+  std::unique_ptr<std::ostream> stream_;
+  std::string buffer_;
+  bool ok_ = true;
+
+  void flushBuffer();
+};
+
+#endif
@@ -32,8 +32,9 @@ HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
                        const HighsLp& lp, HighsBasis& highs_basis,
                        HighsSolution& highs_solution,
                        HighsModelStatus& model_status, HighsInfo& highs_info,
-                       HighsCallback& callback) {
-  // Use IPX to try to solve the LP
+                       HighsCallback& callback, const HighsHessian* hessian) {
+  // Use IPX to try to solve the LP, or the convex QP with the given
+  // Hessian, which must be diagonal
   //
   // Can return HighsModelStatus (HighsStatus) values:
   //
@@ -55,7 +56,8 @@ HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
   //
   // With a non-error return, if just IPM has been run then a
   // non-vertex primal solution is obtained; if crossover has been run
-  // then a basis and primal+dual solution are obtained.
+  // then a basis and primal+dual solution are obtained. Crossover is
+  // never run for a QP.
   //
   //
   // Indicate that there is no valid primal solution, dual solution or basis
@@ -125,7 +127,7 @@ HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
   //
   // When doing analytic centring calculations, crossover must not be
   // run
-  if (options.run_centring) {
+  if (options.run_centring || hessian) {
     parameters.run_crossover = 0;
   } else if (options.run_crossover == kHighsOnString) {
     parameters.run_crossover = 1;
@@ -163,9 +165,23 @@ HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
                " columns and %" HIGHSINT_FORMAT " nonzeros\n",
                num_row, num_col, Ap[num_col]);
 
+  // IPX takes the Hessian as its diagonal, signed by the objective
+  // sense like the costs, and zero for the slacks of boxed rows
+  std::vector<double> hessian_diagonal;
+  if (hessian) {
+    assert(hessian->isDiagonal());
+    hessian_diagonal.assign(num_col, 0);
+    for (HighsInt iCol = 0; iCol < hessian->dim_; iCol++) {
+      const HighsInt iEl = hessian->start_[iCol];
+      if (iEl < hessian->start_[iCol + 1] && hessian->index_[iEl] == iCol)
+        hessian_diagonal[iCol] = (HighsInt)lp.sense_ * hessian->value_[iEl];
+    }
+  }
+
   ipx::Int load_status = lps.LoadModel(
       num_col, objective.data(), col_lb.data(), col_ub.data(), num_row,
-      Ap.data(), Ai.data(), Av.data(), rhs.data(), constraint_type.data());
+      Ap.data(), Ai.data(), Av.data(), rhs.data(), constraint_type.data(),
+      hessian ? hessian_diagonal.data() : nullptr);
 
   if (load_status) {
     model_status = HighsModelStatus::kSolveError;
@@ -225,7 +241,7 @@ HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
     const HighsModelStatus local_model_status = HighsModelStatus::kUnknown;
     getHighsNonVertexSolution(options, lp, num_col, num_row, rhs,
                               constraint_type, lps, local_model_status,
-                              highs_solution);
+                              highs_solution, hessian != nullptr);
     //
     // Look at the reason why IPX stopped
     //
@@ -303,7 +319,7 @@ HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
     }
     getHighsNonVertexSolution(options, lp, num_col, num_row, rhs,
                               constraint_type, lps, model_status,
-                              highs_solution);
+                              highs_solution, hessian != nullptr);
     return HighsStatus::kOk;
   }
 
@@ -373,7 +389,7 @@ HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
                            : HighsModelStatus::kOptimal;
     getHighsNonVertexSolution(options, lp, num_col, num_row, rhs,
                               constraint_type, lps, local_model_status,
-                              highs_solution);
+                              highs_solution, hessian != nullptr);
     assert(!highs_basis.valid);
   }
   highs_info.basis_validity =
@@ -851,7 +867,8 @@ void getHighsNonVertexSolution(const HighsOptions& options, const HighsLp& lp,
                                const std::vector<char>& constraint_type,
                                const ipx::LpSolver& lps,
                                const HighsModelStatus model_status,
-                               HighsSolution& highs_solution) {
+                               HighsSolution& highs_solution,
+                               const bool is_qp) {
   // Get the interior solution (available if IPM was started).
   // GetInteriorSolution() returns the final IPM iterate, regardless if the
   // IPM terminated successfully or not. (Only in case of out-of-memory no
@@ -869,7 +886,7 @@ void getHighsNonVertexSolution(const HighsOptions& options, const HighsLp& lp,
 
   ipxSolutionToHighsSolution(options, lp, rhs, constraint_type, num_col,
                              num_row, x, slack, y, zl, zu, model_status,
-                             highs_solution);
+                             highs_solution, is_qp);
 }
 
 void reportSolveData(const HighsLogOptions& log_options,
@@ -21,6 +21,7 @@
 #include "ipm/ipx/ipx_status.h"
 #include "ipm/ipx/lp_solver.h"
 #include "lp_data/HighsSolution.h"
+#include "model/HighsHessian.h"
 
 HighsStatus solveLpIpx(HighsLpSolverObject& solver_object);
 
@@ -28,7 +29,8 @@ HighsStatus solveLpIpx(const HighsOptions& options, HighsTimer& timer,
                        const HighsLp& lp, HighsBasis& highs_basis,
                        HighsSolution& highs_solution,
                        HighsModelStatus& model_status, HighsInfo& highs_info,
-                       HighsCallback& callback);
+                       HighsCallback& callback,
+                       const HighsHessian* hessian = nullptr);
 
 void fillInIpxData(const HighsLp& lp, ipx::Int& num_col, ipx::Int& num_row,
                    std::vector<double>& obj, std::vector<double>& col_lb,
@@ -66,7 +68,8 @@ void getHighsNonVertexSolution(const HighsOptions& options, const HighsLp& lp,
                                const std::vector<char>& constraint_type,
                                const ipx::LpSolver& lps,
                                const HighsModelStatus model_status,
-                               HighsSolution& highs_solution);
+                               HighsSolution& highs_solution,
+                               const bool is_qp = false);
 
 void reportSolveData(const HighsLogOptions& log_options,
                      const ipx::Info& ipx_info);
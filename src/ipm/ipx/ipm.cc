@@ -784,11 +784,15 @@ void IPM::SolveNewtonSystem(const double* rb, const double* rc,
     assert(AllFinite(dzl));
     assert(AllFinite(dzu));
 
-    // Shift residual to the last two block equations.
+    // Shift residual to the last two block equations. With a Hessian, the
+    // first block equation reads Q*dx-AI'dy-dzl+dzu = -rc.
+    const Vector& qdiag = model.qdiag();
     for (Int j = 0; j < n+m; j++) {
         if (iterate_->StateOf(j) == Iterate::State::barrier) {
             assert(std::isfinite(xl[j]) || std::isfinite(xu[j]));
             double atdy = DotColumn(AI, j, dy);
+            if (j < n && model.has_hessian())
+                atdy -= qdiag[j] * dx[j];
             double rcj = rc ? rc[j] : 0.0;
             if (std::isfinite(xl[j]) && std::isfinite(xu[j])) {
                 if (zl[j]*xu[j] >= zu[j]*xl[j])
@@ -562,10 +562,15 @@ void Iterate::ComputeResiduals() const {
     rb_ = model_.b();
     MultiplyAdd(AI, x_, -1.0, rb_, 'N');
 
-    // Dual residual: rc = c-AI'y-zl+zu. If the iterate has not been
+    // Dual residual: rc = c+Q*x-AI'y-zl+zu. If the iterate has not been
     // postprocessed, then the dual residual for fixed variables is zero
     // because these variables are treated as non-existent by the IPM.
     rc_ = model_.c() - zl_ + zu_;
+    if (model_.has_hessian()) {
+        const Vector& qdiag = model_.qdiag();
+        for (Int j = 0; j < n; j++)
+            rc_[j] += qdiag[j] * x_[j];
+    }
     MultiplyAdd(AI, y_, -1.0, rc_, 'T');
     if (!postprocessed_) {
         for (Int j = 0; j < n+m; j++)
@@ -614,11 +619,20 @@ void Iterate::ComputeObjectives() const {
     const Vector& ub = model_.ub();
     const SparseMatrix& AI = model_.AI();
 
+    // The quadratic term x'Q*x/2 is added to the primal objective and
+    // subtracted from the dual objective.
+    double qobjective = 0.0;
+    if (model_.has_hessian()) {
+        const Vector& qdiag = model_.qdiag();
+        for (Int j = 0; j < n; j++)
+            qobjective += 0.5 * qdiag[j] * x_[j] * x_[j];
+    }
+
     if (postprocessed_) {
         // Compute objective values as defined for the LP model.
         offset_ = 0.0;
-        pobjective_ = Dot(c, x_);
-        dobjective_ = Dot(b, y_);
+        pobjective_ = Dot(c, x_) + qobjective;
+        dobjective_ = Dot(b, y_) - qobjective;
         for (Int j = 0; j < n+m; j++) {
             if (std::isfinite(lb[j]))
                 dobjective_ += lb[j] * zl_[j];
@@ -630,7 +644,7 @@ void Iterate::ComputeObjectives() const {
         // (after fixing and implying variables). The offset is such that
         // pobjective_ + offset_ is the primal objective after postprocessing.
         offset_ = 0.0;
-        pobjective_ = 0.0;
+        pobjective_ = qobjective;
         for (Int j = 0; j < n+m; j++) {
             if (StateOf(j) != State::fixed)
                 pobjective_ += c[j] * x_[j];
@@ -643,7 +657,7 @@ void Iterate::ComputeObjectives() const {
                 offset_ += (zl_[j]-zu_[j]) * x_[j];
             }
         }
-        dobjective_ = Dot(b, y_);
+        dobjective_ = Dot(b, y_) - qobjective;
         for (Int j = 0; j < n+m; j++) {
             if (has_barrier_lb(j))
                 dobjective_ += lb[j] * zl_[j];
@@ -81,7 +81,7 @@ public:
     // rb = b-AI*x,
     // rl = lb-x+xl,
     // ru = ub-x-xu,
-    // rc = c-AI'y-zl+zu.
+    // rc = c+Q*x-AI'y-zl+zu.
     // Warning: The residuals are not evaluated immediately after a change to
     // an Iterate object (such as by Update() or make_fixed()). Instead, the
     // four residual vectors are evaluated when any of them is required, e.g.
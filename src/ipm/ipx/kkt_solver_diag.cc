@@ -30,12 +30,17 @@ void KKTSolverDiag::_Factorize(Iterate* pt, Info* info) {
         // Build matrix W for AI*W*AI'. For free variables set W[j] to
         // 1.0/regval, where regval is a regularization value. regval is chosen
         // as the minimum of the complementarity measure mu and the smallest
-        // nonzero diagonal entry of the (1,1) block of the KKT matrix.
+        // nonzero diagonal entry of the (1,1) block of the KKT matrix. If the
+        // model has a Hessian, then its diagonal is part of the (1,1) block.
+        const Vector& qdiag = model_.qdiag();
+        const bool has_hessian = model_.has_hessian();
         double regval = pt->mu();
         for (Int j = 0; j < n+m; j++) {
             assert(xl[j] > 0.0);
             assert(xu[j] > 0.0);
             double g = zl[j]/xl[j] + zu[j]/xu[j];
+            if (has_hessian && j < n)
+                g += qdiag[j];
             assert(std::isfinite(g));
             if (g != 0.0 && g < regval)
                 regval = g;
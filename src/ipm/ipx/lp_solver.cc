@@ -15,10 +15,10 @@ namespace ipx {
 Int LpSolver::LoadModel(Int num_var, const double* obj, const double* lb,
                         const double* ub, Int num_constr, const Int* Ap,
                         const Int* Ai, const double* Ax, const double* rhs,
-                        const char* constr_type) {
+                        const char* constr_type, const double* qdiag) {
     ClearModel();
     Int errflag = model_.Load(control_, num_constr, num_var, Ap, Ai, Ax, rhs,
-                              constr_type, obj, lb, ub);
+                              constr_type, obj, lb, ub, qdiag);
     model_.GetInfo(&info_);
     return errflag;
 }
@@ -59,9 +59,10 @@ Int LpSolver::Solve() {
 	const bool run_crossover_on = control_.run_crossover() == 1;
 	const bool run_crossover_choose = control_.run_crossover() == -1;
 	const bool run_crossover_not_off = run_crossover_choose || run_crossover_on;
-	const bool run_crossover =
-	  (info_.status_ipm == IPX_STATUS_optimal && run_crossover_on) ||
-	  (info_.status_ipm == IPX_STATUS_imprecise && run_crossover_not_off);
+	// Crossover to a basic solution is only defined for an LP
+	const bool run_crossover = !model_.has_hessian() &&
+	  ((info_.status_ipm == IPX_STATUS_optimal && run_crossover_on) ||
+	   (info_.status_ipm == IPX_STATUS_imprecise && run_crossover_not_off));
 	//        if ((info_.status_ipm == IPX_STATUS_optimal ||
 	//             info_.status_ipm == IPX_STATUS_imprecise) && run_crossover_on) {
 	if (run_crossover) {
@@ -360,7 +361,7 @@ void LpSolver::InteriorPointSolve() {
     iterate_.reset(new Iterate(model_));
     iterate_->feasibility_tol(control_.ipm_feasibility_tol());
     iterate_->optimality_tol(control_.ipm_optimality_tol());
-    if (control_.run_crossover())
+    if (control_.run_crossover() && !model_.has_hessian())
         iterate_->start_crossover_tol(control_.start_crossover_tol());
 
     RunIPM();
@@ -397,9 +398,15 @@ void LpSolver::RunIPM() {
         ComputeStartingPoint(ipm);
         if (info_.status_ipm != IPX_STATUS_not_run)
             return;
-        RunInitialIPM(ipm);
-        if (info_.status_ipm != IPX_STATUS_not_run)
-            return;
+        if (!model_.has_hessian()) {
+            RunInitialIPM(ipm);
+            if (info_.status_ipm != IPX_STATUS_not_run)
+                return;
+        }
+    }
+    if (model_.has_hessian()) {
+        RunHessianIPM(ipm);
+        return;
     }
     BuildStartingBasis();
     if (info_.status_ipm != IPX_STATUS_not_run || 
@@ -558,6 +565,18 @@ void LpSolver::RunMainIPM(IPM& ipm) {
     info_.time_ipm2 = timer.Elapsed();
 }
 
+void LpSolver::RunHessianIPM(IPM& ipm) {
+    // The basis preconditioner works with a model in which variables can be
+    // fixed or made free when they have converged, which is not valid with a
+    // Hessian. Hence a QP is solved by the IPM with diagonal preconditioning
+    // throughout, and no starting basis is built.
+    KKTSolverDiag kkt(control_, model_);
+    Timer timer;
+    ipm.maxiter(control_.ipm_maxiter());
+    ipm.Driver(&kkt, iterate_.get(), &info_);
+    info_.time_ipm2 = timer.Elapsed();
+}
+
 void LpSolver::BuildCrossoverStartingPoint() {
     const Int m = model_.rows();
     const Int n = model_.cols();
@@ -22,6 +22,10 @@ public:
     // @Ap, @Ai, @Ax: constraint matrix in CSC format; indices can be unsorted.
     // @rhs: size num_constr array of right-hand side entries.
     // @constr_type: size num_constr array of entries '>', '<' and '='.
+    // @qdiag: NULL for an LP, or size num_var array of (finite, nonnegative)
+    //         diagonal entries of a Hessian Q, in which case the objective is
+    //         obj'x + 1/2 x'Q*x. A QP is never dualized and crossover is not
+    //         available for it.
     // Returns:
     //  0
     //  IPX_ERROR_argument_null
@@ -31,7 +35,7 @@ public:
     Int LoadModel(Int num_var, const double* obj, const double* lb,
                   const double* ub, Int num_constr, const Int* Ap,
                   const Int* Ai, const double* Ax, const double* rhs,
-                  const char* constr_type);
+                  const char* constr_type, const double* qdiag = nullptr);
 
     // Loads a primal-dual point as starting point for the IPM.
     // @x: size num_var array
@@ -172,6 +176,7 @@ private:
     void RunInitialIPM(IPM& ipm);
     void BuildStartingBasis();
     void RunMainIPM(IPM& ipm);
+    void RunHessianIPM(IPM& ipm);
     void BuildCrossoverStartingPoint();
     void RunCrossover();
     void PrintSummary();
@@ -10,10 +10,11 @@ namespace ipx {
 Int Model::Load(const Control& control, Int num_constr, Int num_var,
                 const Int* Ap, const Int* Ai, const double* Ax,
                 const double* rhs, const char* constr_type, const double* obj,
-                const double* lbuser, const double* ubuser) {
+                const double* lbuser, const double* ubuser,
+                const double* qdiag) {
     clear();
     Int errflag = CopyInput(num_constr, num_var, Ap, Ai, Ax, rhs, constr_type,
-                            obj, lbuser, ubuser);
+                            obj, lbuser, ubuser, qdiag);
     if (errflag)
         return errflag;
     std::stringstream h_logging_stream;
@@ -43,6 +44,10 @@ Int Model::Load(const Control& control, Int num_constr, Int num_var,
     } else if (dualize == -2) {
       dualize = dualize_filippo;
     }
+    // The dual of a QP involves the primal variables again, so a model with a
+    // Hessian is always solved in primal form.
+    if (scaled_qdiag_.size() > 0)
+        dualize = 0;
     if (dualize)
         LoadDual();
     else
@@ -92,6 +97,7 @@ void Model::clear() {
     c_.resize(0);
     lb_.resize(0);
     ub_.resize(0);
+    qdiag_.resize(0);
     norm_bounds_ = 0.0;
     norm_c_ = 0.0;
 
@@ -109,6 +115,7 @@ void Model::clear() {
     scaled_rhs_.resize(0);
     scaled_lbuser_.resize(0);
     scaled_ubuser_.resize(0);
+    scaled_qdiag_.resize(0);
     A_.clear();
 
     flipped_vars_.clear();
@@ -323,11 +330,16 @@ void Model::EvaluateInteriorSolution(const Vector& x_solver,
     MultiplyWithScaledMatrix(x, -1.0, rb, 'N');
     rb -= slack;
     rb += scaled_rhs_;
-    // rc = obj-zl+zu-A'y
+    // rc = obj+Q*x-zl+zu-A'y
     // Add obj at the end to avoid losing digits when y, z are huge.
     Vector rc(num_var_);
     MultiplyWithScaledMatrix(y, -1.0, rc, 'T');
     rc -= zl - zu;
+    Vector qx(0.0, num_var_);
+    if (scaled_qdiag_.size() > 0) {
+        qx = scaled_qdiag_ * x;
+        rc += qx;
+    }
     rc += scaled_obj_;
     
     ScaleBackResiduals(rb, rc, rl, ru);
@@ -336,8 +348,11 @@ void Model::EvaluateInteriorSolution(const Vector& x_solver,
     presidual = std::max(presidual, Infnorm(ru));
     double dresidual = Infnorm(rc);
 
-    double pobjective = Dot(scaled_obj_, x);
-    double dobjective = Dot(scaled_rhs_, y);
+    // The quadratic term x'Q*x/2 enters the primal objective with a positive
+    // and the (Wolfe) dual objective with a negative sign.
+    const double qobjective = 0.5 * Dot(qx, x);
+    double pobjective = Dot(scaled_obj_, x) + qobjective;
+    double dobjective = Dot(scaled_rhs_, y) - qobjective;
     for (Int j = 0; j < num_var_; j++) {
         if (std::isfinite(scaled_lbuser_[j]))
             dobjective += scaled_lbuser_[j] * zl[j];
@@ -489,9 +504,10 @@ void Model::PostsolveBasis(const std::vector<Int>& basic_status_solver,
 }
 
 // Checks if the vectors are valid LP data vectors. Returns 0 if OK and a
-// negative value if a vector is invalid.
+// negative value if a vector is invalid. @qdiag can be NULL.
 static int CheckVectors(Int m, Int n, const double* rhs,const char* constr_type,
-                        const double* obj, const double* lb, const double* ub) {
+                        const double* obj, const double* lb, const double* ub,
+                        const double* qdiag) {
     for (Int i = 0; i < m; i++)
         if (!std::isfinite(rhs[i]))
             return -1;
@@ -510,6 +526,11 @@ static int CheckVectors(Int m, Int n, const double* rhs,const char* constr_type,
         if (constr_type[i] != '=' && constr_type[i] != '<' &&
             constr_type[i] != '>')
             return -4;
+    if (qdiag) {
+        for (Int j = 0; j < n; j++)
+            if (!std::isfinite(qdiag[j]) || qdiag[j] < 0.0)
+                return -5;
+    }
     return 0;
 }
 
@@ -542,15 +563,16 @@ static Int CheckMatrix(Int m, Int n, const Int *Ap, const Int *Ai, const double
 Int Model::CopyInput(Int num_constr, Int num_var, const Int* Ap, const Int* Ai,
                      const double* Ax, const double* rhs,
                      const char* constr_type, const double* obj,
-                     const double* lbuser, const double* ubuser) {
+                     const double* lbuser, const double* ubuser,
+                     const double* qdiag) {
     if (!(Ap && Ai && Ax && rhs && constr_type && obj && lbuser && ubuser)) {
         return IPX_ERROR_argument_null;
     }
     if (num_constr < 0 || num_var <= 0) {
         return IPX_ERROR_invalid_dimension;
     }
-    if (CheckVectors(num_constr, num_var, rhs, constr_type, obj, lbuser, ubuser)
-        != 0) {
+    if (CheckVectors(num_constr, num_var, rhs, constr_type, obj, lbuser, ubuser,
+                     qdiag) != 0) {
         return IPX_ERROR_invalid_vector;
     }
     if (CheckMatrix(num_constr, num_var, Ap, Ai, Ax) != 0) {
@@ -573,6 +595,11 @@ Int Model::CopyInput(Int num_constr, Int num_var, const Int* Ap, const Int* Ai,
     scaled_rhs_ = Vector(rhs, num_constr);
     scaled_lbuser_ = Vector(lbuser, num_var);
     scaled_ubuser_ = Vector(ubuser, num_var);
+    // An all-zero diagonal makes the model an LP.
+    scaled_qdiag_.resize(0);
+    if (qdiag && std::any_of(qdiag, qdiag+num_var,
+                             [](double q) { return q != 0.0; }))
+        scaled_qdiag_ = Vector(qdiag, num_var);
     A_.LoadFromArrays(num_constr, num_var, Ap, Ap+1, Ai, Ax);
     norm_obj_ = Infnorm(scaled_obj_);
     norm_rhs_ = Infnorm(scaled_rhs_);
@@ -609,6 +636,8 @@ void Model::ScaleModel(const Control& control) {
         scaled_obj_ *= colscale_;
         scaled_lbuser_ /= colscale_;
         scaled_ubuser_ /= colscale_;
+        if (scaled_qdiag_.size() > 0)
+            scaled_qdiag_ *= colscale_ * colscale_;
     }
     if (rowscale_.size() > 0) {
         assert((Int)rowscale_.size() == num_constr_);
@@ -638,6 +667,8 @@ void Model::LoadPrimal() {
     std::copy_n(std::begin(scaled_lbuser_), num_var_, std::begin(lb_));
     ub_.resize(num_rows_+num_cols_);
     std::copy_n(std::begin(scaled_ubuser_), num_var_, std::begin(ub_));
+    qdiag_.resize(scaled_qdiag_.size());
+    qdiag_ = scaled_qdiag_;
     for (Int i = 0; i < num_constr_; i++) {
         switch(constr_type_[i]) {
         case '=':
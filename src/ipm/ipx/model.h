@@ -9,12 +9,12 @@ namespace ipx {
 
 // Model provides the interface between an LP model given by the user,
 //
-//   minimize   obj'x                                                    (1)
+//   minimize   obj'x + 1/2 x'Q*x                                        (1)
 //   subject to A*x {=,<,>} rhs, lbuser <= x <= ubuser,
 //
 // and the computational form used by the solver,
 //
-//   minimize   c'x
+//   minimize   c'x + 1/2 x'Q*x
 //   subject to AI*x = b,                              (dual: y)
 //              x-xl = lb, xl >= 0,                    (dual: zl >= 0)
 //              x+xu = ub, xu >= 0.                    (dual: zu >= 0)
@@ -24,6 +24,9 @@ namespace ipx {
 // The last m components of c do not need to be zero (can happen when the model
 // was dualized in preprocessing). Entries of -lb and ub can be infinity.
 //
+// Q is a nonnegative diagonal matrix that acts on the structural variables
+// only. It is empty for an LP, in which case the model can be dualized.
+//
 // The user model is translated into computational form in two steps:
 // (a) scaling, which consists of
 //     - applying an automatic scaling algorithm to A (optional), and
@@ -48,6 +51,8 @@ public:
     // @obj: array of size num_var
     // @lbuser: array of size num_var, entries can be -INFINITY
     // @ubuser: array of size num_var, entries can be +INFINITY
+    // @qdiag: array of size num_var with the (finite, nonnegative) diagonal of
+    //         Q, or NULL if the model is an LP
     // If the input is invalid an error code is returned and the Model object
     // becomes empty.
     // Returns:
@@ -59,7 +64,8 @@ public:
     Int Load(const Control& control, Int num_constr, Int num_var,
              const Int* Ap, const Int* Ai, const double* Ax,
              const double* rhs, const char* constr_type, const double* obj,
-             const double* lbuser, const double* ubuser);
+             const double* lbuser, const double* ubuser,
+             const double* qdiag = nullptr);
     // Performs Flippo's test for deciding dualization
     bool filippoDualizationTest() const;
     // Writes statistics of input data and preprocessing to @info.
@@ -105,6 +111,13 @@ public:
     double lb(Int j) const { return lb_[j]; }
     double ub(Int j) const { return ub_[j]; }
 
+    // Returns true if the objective has a quadratic term.
+    bool has_hessian() const { return qdiag_.size() > 0; }
+
+    // Returns the diagonal of Q for the structural columns, or an empty vector
+    // if the model is an LP.
+    const Vector& qdiag() const { return qdiag_; }
+
     // Returns the infinity norm of [b; lb; ub], ignoring infinite entries.
     double norm_bounds() const { return norm_bounds_; }
 
@@ -208,13 +221,13 @@ private:
     Int CopyInput(Int num_constr, Int num_var, const Int* Ap, const Int* Ai,
                   const double* Ax, const double* rhs, const char* constr_type,
                   const double* obj, const double* lbuser,
-                  const double* ubuser);
+                  const double* ubuser, const double* qdiag);
 
-    // Scales A_, scaled_obj_, scaled_rhs_, scaled_lbuser_ and scaled_ubuser_
-    // according to parameter control.scale(). The scaling factors are stored in
-    // colscale_ and rowscale_. If all factors are 1.0 (either because scaling
-    // was turned off or because the algorithm did nothing), rowscale_ and
-    // colscale_ have size 0.
+    // Scales A_, scaled_obj_, scaled_rhs_, scaled_lbuser_, scaled_ubuser_ and
+    // scaled_qdiag_ according to parameter control.scale(). The scaling
+    // factors are stored in colscale_ and rowscale_. If all factors are 1.0
+    // (either because scaling was turned off or because the algorithm did
+    // nothing), rowscale_ and colscale_ have size 0.
     // In any case, variables for which lbuser is infinite but ubbuser is finite
     // are "flipped" and their indices are kept in flipped_vars_.
     void ScaleModel(const Control& control);
@@ -227,6 +240,7 @@ private:
     // c        = [obj    ; zeros(nc)                      ]
     // lb       = [lbuser ; constr_type_ .== '>' ? -Inf : 0]
     // ub       = [ubuser ; constr_type_ .== '<' ? +Inf : 0]
+    // qdiag    = qdiag
     // dualized = false
     // Here nc = num_constr and nv = num_var. The data must have been loaded
     // into the class member below ("User model after scaling") before calling
@@ -362,6 +376,7 @@ private:
     Vector c_;
     Vector lb_;
     Vector ub_;
+    Vector qdiag_;                // diagonal of Q, empty for an LP
     double norm_bounds_{0.0};     // infinity norm of [b;lb;ub]
     double norm_c_{0.0};          // infinity norm of c
 
@@ -380,6 +395,7 @@ private:
     Vector scaled_rhs_;
     Vector scaled_lbuser_;
     Vector scaled_ubuser_;
+    Vector scaled_qdiag_;
     SparseMatrix A_;              // is cleared after preprocessing
 
     // Data from ScaleModel() that is required by ScaleBack*().
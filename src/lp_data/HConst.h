@@ -264,6 +264,23 @@ enum PresolveRuleType : int {
   kPresolveRuleCount,
 };
 
+// Types of presolve passes, each of which may apply many reductions
+enum PresolvePassType : int {
+  kPresolvePassIllegal = -1,
+  kPresolvePassMin = 0,
+  kPresolvePassFastLoop = kPresolvePassMin,
+  kPresolvePassAggregator,
+  kPresolvePassSparsify,
+  kPresolvePassParallelRowsAndCols,
+  kPresolvePassStrengthenInequalities,
+  kPresolvePassDominatedCols,
+  kPresolvePassProbing,
+  kPresolvePassDependentEquations,
+  kPresolvePassDependentFreeCols,
+  kPresolvePassMax = kPresolvePassDependentFreeCols,
+  kPresolvePassCount,
+};
+
 // Default and max allowed power-of-two matrix scale factor
 const HighsInt kDefaultAllowedMatrixPow2Scale = 20;
 const HighsInt kMaxAllowedMatrixPow2Scale = 30;
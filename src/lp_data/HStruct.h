@@ -128,8 +128,19 @@ struct HighsPresolveRuleLog {
   HighsInt row_removed;
 };
 
+struct HighsPresolvePassLog {
+  HighsInt call;
+  HighsInt success;
+  HighsInt col_removed;
+  HighsInt row_removed;
+  HighsInt nz_removed;
+  int64_t nz_touched;
+  double time;
+};
+
 struct HighsPresolveLog {
   std::vector<HighsPresolveRuleLog> rule;
+  std::vector<HighsPresolvePassLog> pass;
   void clear();
 };
 
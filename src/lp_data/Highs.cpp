@@ -23,11 +23,14 @@
 
 #include "io/Filereader.h"
 #include "io/LoadOptions.h"
+#include "ipm/IpxWrapper.h"
 #include "lp_data/HighsCallbackStruct.h"
 #include "lp_data/HighsInfoDebug.h"
 #include "lp_data/HighsLpSolverObject.h"
 #include "lp_data/HighsSolve.h"
+#include "mip/HighsMipCheckpoint.h"
 #include "mip/HighsMipSolver.h"
+#include "mip/HighsMiqpSolver.h"
 #include "model/HighsHessianUtils.h"
 #include "parallel/HighsParallel.h"
 #include "presolve/ICrashX.h"
@@ -632,8 +635,8 @@ HighsStatus Highs::readModel(const std::string& filename) {
   HighsModel model;
   FilereaderRetcode call_code =
       reader->readModelFromFile(options_, filename, model);
-  delete reader;
   if (call_code != FilereaderRetcode::kOk) {
+    delete reader;
     interpretFilereaderRetcode(options_.log_options, filename.c_str(),
                                call_code);
     return_status =
@@ -642,6 +645,12 @@ HighsStatus Highs::readModel(const std::string& filename) {
     if (return_status == HighsStatus::kError) return return_status;
   }
   model.lp_.model_name_ = extractModelName(filename);
+  if (!options_.keep_names) {
+    // The MPS reader can avoid storing names, but other readers cannot,
+    // so free any memory used by names here
+    std::vector<std::string>().swap(model.lp_.col_names_);
+    std::vector<std::string>().swap(model.lp_.row_names_);
+  }
   const bool remove_rows_of_count_1 = false;
   if (remove_rows_of_count_1) {
     // .lp files from PWSC (notably st-test23.lp) have bounds for
@@ -655,6 +664,19 @@ HighsStatus Highs::readModel(const std::string& filename) {
   return_status =
       interpretCallStatus(options_.log_options, passModel(std::move(model)),
                           return_status, "passModel");
+  if (return_status != HighsStatus::kError && reader->holdsSolution()) {
+    // The basis must be set after the solution, since setting the
+    // solution invalidates the basis
+    if (reader->solution_.value_valid)
+      return_status = interpretCallStatus(options_.log_options,
+                                          setSolution(reader->solution_),
+                                          return_status, "setSolution");
+    if (return_status != HighsStatus::kError && reader->basis_.valid)
+      return_status = interpretCallStatus(options_.log_options,
+                                          setBasis(reader->basis_),
+                                          return_status, "setBasis");
+  }
+  delete reader;
   return returnFromHighs(return_status);
 }
 
@@ -723,6 +745,14 @@ HighsStatus Highs::writeLocalModel(HighsModel& model,
     // Report to user that model is being written
     highsLogUser(options_.log_options, HighsLogType::kInfo,
                  "Writing the model to %s\n", filename.c_str());
+    if (writer->holdsSolution() && &model == &model_) {
+      writer->basis_ = basis_;
+      writer->solution_ = solution_;
+    }
+    // Large sections of text files are formatted in parallel, using the
+    // scheduler if it is already running
+    if (HighsTaskExecutor::getThisWorkerDeque() == nullptr)
+      highs::parallel::initialize_scheduler(options_.threads);
     return_status =
         interpretCallStatus(options_.log_options,
                             writer->writeModelToFile(options_, filename, model),
@@ -1042,28 +1072,41 @@ HighsStatus Highs::run() {
   }
   const bool use_simplex_or_ipm =
       (options_.solver.compare(kHighsChooseString) != 0);
-  if (!use_simplex_or_ipm) {
+  // A QP can also be solved by IPX, which is handled by callSolveQp
+  const bool ipm_for_qp = model_.isQp() && options_.solver == kIpmString;
+  if (!use_simplex_or_ipm || ipm_for_qp) {
     // Leaving HiGHS to choose method according to model class
     if (model_.isQp()) {
+      // Ensure that its diagonal entries are OK in the context of the
+      // objective sense. It's OK to be semi-definite
+      if (!okHessianDiagonal(options_, model_.hessian_, model_.lp_.sense_)) {
+        highsLogUser(options_.log_options, HighsLogType::kError,
+                     "Cannot solve non-convex QP problems with HiGHS\n");
+        return returnFromRun(HighsStatus::kError, undo_mods);
+      }
       if (model_.isMip()) {
         if (options_.solve_relaxation) {
           // Relax any semi-variables
           bool made_semi_variable_mods = false;
           relaxSemiVariables(model_.lp_, made_semi_variable_mods);
           undo_mods = undo_mods || made_semi_variable_mods;
-        } else {
+        } else if (!options_.miqp_branch_and_bound) {
           highsLogUser(options_.log_options, HighsLogType::kError,
                        "Cannot solve MIQP problems with HiGHS\n");
           return returnFromRun(HighsStatus::kError, undo_mods);
+        } else if (model_.lp_.hasSemiVariables()) {
+          highsLogUser(options_.log_options, HighsLogType::kError,
+                       "Cannot solve MIQP problems with semi-variables "
+                       "with HiGHS\n");
+          return returnFromRun(HighsStatus::kError, undo_mods);
+        } else {
+          call_status = callSolveMiqp();
+          return_status = interpretCallStatus(
+              options_.log_options, call_status, return_status,
+              "callSolveMiqp");
+          return returnFromRun(return_status, undo_mods);
         }
       }
-      // Ensure that its diagonal entries are OK in the context of the
-      // objective sense. It's OK to be semi-definite
-      if (!okHessianDiagonal(options_, model_.hessian_, model_.lp_.sense_)) {
-        highsLogUser(options_.log_options, HighsLogType::kError,
-                     "Cannot solve non-convex QP problems with HiGHS\n");
-        return returnFromRun(HighsStatus::kError, undo_mods);
-      }
       call_status = callSolveQp();
       return_status = interpretCallStatus(options_.log_options, call_status,
                                           return_status, "callSolveQp");
@@ -1304,8 +1347,25 @@ HighsStatus Highs::run() {
         // objective values aren't correct
         const double save_objective_bound = options_.objective_bound;
         options_.objective_bound = kHighsInf;
-        solveLp(reduced_lp, "Solving the presolved LP",
-                this_solve_presolved_lp_time);
+        // Possibly solve the independent blocks of the presolved LP
+        // separately
+        HighsInt num_component = 0;
+        std::vector<HighsInt> col_component;
+        std::vector<HighsInt> row_component;
+        if (options_.lp_presolve_decompose)
+          num_component =
+              getLpComponents(reduced_lp, col_component, row_component);
+        if (num_component > 1) {
+          this_solve_presolved_lp_time = -timer_.read(timer_.solve_clock);
+          timer_.start(timer_.solve_clock);
+          call_status = callSolveLpByComponents(reduced_lp, num_component,
+                                                col_component, row_component);
+          timer_.stop(timer_.solve_clock);
+          this_solve_presolved_lp_time += timer_.read(timer_.solve_clock);
+        } else {
+          solveLp(reduced_lp, "Solving the presolved LP",
+                  this_solve_presolved_lp_time);
+        }
         if (ekk_instance_.status_.initialised_for_solve) {
           // Record the pivot threshold resulting from solving the presolved LP
           // with simplex
@@ -2123,8 +2183,11 @@ HighsStatus Highs::setBasis(const HighsBasis& basis,
         (int)basis_.debug_update_count, basis_.debug_origin_name.c_str());
   }
 
-  // Follow implications of a new HiGHS basis
-  newHighsBasis();
+  // Follow implications of a new HiGHS basis, unless it has the basic
+  // variables of the current simplex basis, in which case its
+  // factorization is kept
+  if (!ekk_instance_.setBasisKeepingInvert(model_.lp_, basis_))
+    newHighsBasis();
   // Can't use returnFromHighs since...
   return HighsStatus::kOk;
 }
@@ -3087,6 +3150,41 @@ HighsStatus Highs::readSolution(const std::string& filename,
                           style);
 }
 
+HighsStatus Highs::resumeMip(const std::string& checkpoint_file) {
+  if (!model_.isMip()) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "Highs::resumeMip: model is not a MIP\n");
+    return HighsStatus::kError;
+  }
+  std::shared_ptr<HighsMipCheckpoint> checkpoint =
+      std::make_shared<HighsMipCheckpoint>();
+  if (!checkpoint->read(checkpoint_file)) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "Highs::resumeMip: unable to read MIP checkpoint file %s\n",
+                 checkpoint_file.c_str());
+    return HighsStatus::kError;
+  }
+  if (checkpoint->origNumCol != model_.lp_.num_col_) {
+    highsLogUser(options_.log_options, HighsLogType::kError,
+                 "Highs::resumeMip: MIP checkpoint has %d columns but the "
+                 "model has %d\n",
+                 int(checkpoint->origNumCol), int(model_.lp_.num_col_));
+    return HighsStatus::kError;
+  }
+  // the incumbent of the checkpoint is passed as a start solution
+  if (!checkpoint->incumbent.empty()) {
+    HighsSolution start_solution;
+    start_solution.col_value = checkpoint->incumbent;
+    start_solution.value_valid = true;
+    if (setSolution(start_solution) == HighsStatus::kError)
+      return HighsStatus::kError;
+  }
+  mip_checkpoint_ = checkpoint;
+  HighsStatus return_status = run();
+  mip_checkpoint_.reset();
+  return return_status;
+}
+
 HighsStatus Highs::assessPrimalSolution(bool& valid, bool& integral,
                                         bool& feasible) const {
   return assessLpPrimalSolution(options_, model_.lp_, solution_, valid,
@@ -3211,7 +3309,7 @@ HighsPresolveStatus Highs::runPresolve(const bool force_lp_presolve,
     presolve_.data_.reduced_lp_ = solver.getPresolvedModel();
     presolve_.data_.postSolveStack = solver.getPostsolveStack();
     presolve_.presolve_status_ = presolve_return_status;
-    //    presolve_.data_.presolve_log_ =
+    presolve_.data_.presolve_log_ = solver.getPresolveLog();
   } else {
     // Use presolve for LP
     presolve_.init(original_lp, timer_);
@@ -3436,6 +3534,150 @@ HighsStatus Highs::callSolveLp(HighsLp& lp, const string message) {
   return return_status;
 }
 
+// The method below solves the independent components of an LP as
+// separate LPs in parallel, and then combines their solutions and bases
+HighsStatus Highs::callSolveLpByComponents(
+    HighsLp& lp, const HighsInt num_component,
+    const std::vector<HighsInt>& col_component,
+    const std::vector<HighsInt>& row_component) {
+  highsLogUser(options_.log_options, HighsLogType::kInfo,
+               "Solving the presolved LP as %d independent LPs\n",
+               int(num_component));
+  // Identify the columns and rows of each component, and the index of
+  // each row within its component
+  std::vector<std::vector<HighsInt>> component_col(num_component);
+  std::vector<std::vector<HighsInt>> component_row(num_component);
+  std::vector<HighsInt> row_component_index(lp.num_row_);
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++)
+    component_col[col_component[iCol]].push_back(iCol);
+  for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++) {
+    row_component_index[iRow] = component_row[row_component[iRow]].size();
+    component_row[row_component[iRow]].push_back(iRow);
+  }
+
+  // Each component is solved silently, with the time remaining
+  HighsOptions component_options = options_;
+  component_options.output_flag = false;
+  component_options.time_limit =
+      options_.time_limit - timer_.read(timer_.run_highs_clock);
+
+  struct ComponentSolve {
+    HighsLp lp;
+    HighsBasis basis;
+    HighsSolution solution;
+    HighsInfo info;
+    HighsModelStatus model_status = HighsModelStatus::kNotset;
+    HighsStatus status = HighsStatus::kOk;
+  };
+  std::vector<ComponentSolve> component(num_component);
+  for (HighsInt iComponent = 0; iComponent < num_component; iComponent++)
+    getLpComponent(lp, component_col[iComponent], component_row[iComponent],
+                   row_component_index, component[iComponent].lp);
+
+  // If the user's callback is defined, the solver of each component
+  // is passed it so that it can be interrupted. The callback writes
+  // to its data and need not be thread safe, so the components are
+  // then solved in turn. Otherwise each component is solved with its
+  // own default callback, since the solvers write to the callback
+  // data even when there is no user callback
+  const bool solve_in_turn = callback_.user_callback != nullptr;
+  auto solveComponents = [&](HighsInt start, HighsInt end) {
+    for (HighsInt iComponent = start; iComponent < end; iComponent++) {
+      ComponentSolve& solve = component[iComponent];
+      HighsOptions options = component_options;
+      HighsTimer timer;
+      timer.startRunHighsClock();
+      HEkk ekk_instance;
+      HighsCallback component_callback;
+      HighsLpSolverObject solver_object(
+          solve.lp, solve.basis, solve.solution, solve.info, ekk_instance,
+          solve_in_turn ? callback_ : component_callback, options, timer);
+      solve.status = solveLp(solver_object, "");
+      solve.model_status = solver_object.model_status_;
+    }
+  };
+  if (solve_in_turn)
+    solveComponents(0, num_component);
+  else
+    highs::parallel::for_each(0, num_component, solveComponents);
+
+  // Combine the model status of the components: any infeasible
+  // component makes the LP infeasible, and otherwise the first
+  // component not solved to optimality determines the model status
+  HighsStatus return_status = HighsStatus::kOk;
+  model_status_ = HighsModelStatus::kOptimal;
+  bool value_valid = true;
+  bool dual_valid = true;
+  bool basis_valid = true;
+  for (HighsInt iComponent = 0; iComponent < num_component; iComponent++) {
+    const ComponentSolve& solve = component[iComponent];
+    return_status = interpretCallStatus(options_.log_options, solve.status,
+                                        return_status, "solveLp");
+    if (solve.model_status == HighsModelStatus::kInfeasible)
+      model_status_ = HighsModelStatus::kInfeasible;
+    else if (model_status_ == HighsModelStatus::kOptimal)
+      model_status_ = solve.model_status;
+    value_valid = value_valid && solve.solution.value_valid;
+    dual_valid = dual_valid && solve.solution.dual_valid;
+    basis_valid = basis_valid && solve.basis.valid;
+    info_.simplex_iteration_count += solve.info.simplex_iteration_count;
+    info_.ipm_iteration_count += solve.info.ipm_iteration_count;
+    info_.crossover_iteration_count += solve.info.crossover_iteration_count;
+    info_.pdlp_iteration_count += solve.info.pdlp_iteration_count;
+  }
+  // The simplex solver has no data for the combined LP, so it must
+  // not be used for hot starting or reporting
+  ekk_instance_.invalidate();
+  if (return_status == HighsStatus::kError) return return_status;
+
+  // Combine the solutions and bases of the components
+  solution_.clear();
+  basis_.clear();
+  if (value_valid) {
+    solution_.col_value.resize(lp.num_col_);
+    solution_.row_value.resize(lp.num_row_);
+  }
+  if (dual_valid) {
+    solution_.col_dual.resize(lp.num_col_);
+    solution_.row_dual.resize(lp.num_row_);
+  }
+  if (basis_valid) {
+    basis_.col_status.resize(lp.num_col_);
+    basis_.row_status.resize(lp.num_row_);
+  }
+  for (HighsInt iComponent = 0; iComponent < num_component; iComponent++) {
+    const ComponentSolve& solve = component[iComponent];
+    const std::vector<HighsInt>& col_set = component_col[iComponent];
+    const std::vector<HighsInt>& row_set = component_row[iComponent];
+    for (size_t iX = 0; iX < col_set.size(); iX++) {
+      const HighsInt iCol = col_set[iX];
+      if (value_valid) solution_.col_value[iCol] = solve.solution.col_value[iX];
+      if (dual_valid) solution_.col_dual[iCol] = solve.solution.col_dual[iX];
+      if (basis_valid) basis_.col_status[iCol] = solve.basis.col_status[iX];
+    }
+    for (size_t iX = 0; iX < row_set.size(); iX++) {
+      const HighsInt iRow = row_set[iX];
+      if (value_valid) solution_.row_value[iRow] = solve.solution.row_value[iX];
+      if (dual_valid) solution_.row_dual[iRow] = solve.solution.row_dual[iX];
+      if (basis_valid) basis_.row_status[iRow] = solve.basis.row_status[iX];
+    }
+  }
+  solution_.value_valid = value_valid;
+  solution_.dual_valid = dual_valid;
+  basis_.valid = basis_valid;
+  basis_.alien = false;
+  basis_.was_alien = false;
+  basis_.debug_origin_name = "Combined from components";
+  info_.basis_validity =
+      basis_valid ? kBasisValidityValid : kBasisValidityInvalid;
+  info_.objective_function_value =
+      value_valid ? lp.objectiveValue(solution_.col_value) : 0;
+  getLpKktFailures(options_, lp, solution_, basis_, info_);
+  if (model_status_ == HighsModelStatus::kOptimal)
+    checkOptimality("LP", return_status);
+  return return_status;
+}
+
 HighsStatus Highs::callSolveQp() {
   // Check that the model is column-wise
   HighsLp& lp = model_.lp_;
@@ -3451,6 +3693,51 @@ HighsStatus Highs::callSolveQp() {
     solution_.dual_valid = false;
     return HighsStatus::kError;
   }
+  if (options_.solver == kIpmString) {
+    // IPX handles a Hessian through the diagonal of its KKT matrix, so
+    // it can only solve QPs with a diagonal Hessian. It needs a
+    // nonempty constraint matrix
+    if (hessian.isDiagonal() && lp.a_matrix_.numNz() > 0) {
+      HighsStatus call_status = callSolveQpIpx();
+      // Without the basis preconditioning that IPX uses for LPs, the
+      // IPM can fail - typically when there are many columns without
+      // a quadratic term - in which case the QP is solved from scratch
+      // by the active set QP solver
+      if (model_status_ != HighsModelStatus::kSolveError) return call_status;
+      highsLogUser(options_.log_options, HighsLogType::kWarning,
+                   "IPX failed to solve the QP, so using the active set QP "
+                   "solver\n");
+    } else {
+      highsLogUser(options_.log_options, HighsLogType::kInfo,
+                   "IPX only solves QPs with a diagonal Hessian and a "
+                   "nonempty constraint matrix, so using the active set QP "
+                   "solver\n");
+    }
+  }
+  // Changing the costs or bounds of a QP that has been solved leaves
+  // the basis valid, and the solution values are retained although
+  // they are no longer valid. If they are still primal feasible and
+  // consistent with the basis, they allow the QP solver to be hot
+  // started, rather than started from a phase 1 LP. Columns that are
+  // active in the basis are moved to their bounds - which may have
+  // changed - and the row values are recomputed. This is done in a
+  // copy of the solution, so that solution_ is only changed by the
+  // result of the QP solver
+  HighsSolution qp_solution = solution_;
+  if (basis_.valid && !qp_solution.value_valid &&
+      HighsInt(qp_solution.col_value.size()) == lp.num_col_) {
+    for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+      const HighsBasisStatus status = basis_.col_status[iCol];
+      if (status == HighsBasisStatus::kLower &&
+          lp.col_lower_[iCol] > -kHighsInf)
+        qp_solution.col_value[iCol] = lp.col_lower_[iCol];
+      else if (status == HighsBasisStatus::kUpper &&
+               lp.col_upper_[iCol] < kHighsInf)
+        qp_solution.col_value[iCol] = lp.col_upper_[iCol];
+    }
+    lp.a_matrix_.productQuad(qp_solution.row_value, qp_solution.col_value);
+    qp_solution.value_valid = true;
+  }
   //
   // Run the QP solver
   Instance instance(lp.num_col_, lp.num_row_);
@@ -3558,7 +3845,8 @@ HighsStatus Highs::callSolveQp() {
                "  Iteration        Objective     NullspaceDim\n");
 
   QpAsmStatus status = solveqp(instance, settings, stats, model_status_, basis_,
-                               solution_, timer_);
+                               qp_solution, timer_);
+  solution_ = std::move(qp_solution);
   // QP solver can fail, so should return something other than QpAsmStatus::kOk
   if (status == QpAsmStatus::kError) return HighsStatus::kError;
 
@@ -3579,6 +3867,34 @@ HighsStatus Highs::callSolveQp() {
   return return_status;
 }
 
+HighsStatus Highs::callSolveQpIpx() {
+  HighsLp& lp = model_.lp_;
+  HighsStatus return_status;
+  try {
+    return_status = solveLpIpx(options_, timer_, lp, basis_, solution_,
+                               model_status_, info_, callback_,
+                               &model_.hessian_);
+  } catch (const std::exception& exception) {
+    highsLogDev(options_.log_options, HighsLogType::kError,
+                "Exception %s in solveLpIpx\n", exception.what());
+    return_status = HighsStatus::kError;
+  }
+  if (return_status == HighsStatus::kError) {
+    model_status_ = HighsModelStatus::kSolveError;
+    return return_status;
+  }
+  // There is no crossover, so the solution is not basic
+  assert(!basis_.valid);
+  if (solution_.value_valid)
+    info_.objective_function_value =
+        model_.objectiveValue(solution_.col_value);
+  getKktFailures(options_, model_, solution_, basis_, info_);
+  info_.valid = true;
+  if (model_status_ == HighsModelStatus::kOptimal)
+    checkOptimality("QP", return_status);
+  return return_status;
+}
+
 HighsStatus Highs::callSolveMip() {
   // Record whether there is a valid primal solution on entry
   const bool user_solution = solution_.value_valid;
@@ -3613,6 +3929,8 @@ HighsStatus Highs::callSolveMip() {
   }
   HighsLp& lp = has_semi_variables ? use_lp : model_.lp_;
   HighsMipSolver solver(callback_, options_, lp, solution_);
+  if (mip_checkpoint_ && mip_checkpoint_->origNumCol == lp.num_col_)
+    solver.checkpoint = mip_checkpoint_.get();
   solver.run();
   options_.log_dev_level = log_dev_level;
   // Set the return_status, model status and, for completeness, scaled
@@ -3699,6 +4017,46 @@ HighsStatus Highs::callSolveMip() {
   return return_status;
 }
 
+HighsStatus Highs::callSolveMiqp() {
+  // Ensure that any solver data for users in Highs class members are
+  // cleared
+  invalidateUserSolverData();
+  HighsMiqpSolver solver(options_, model_, timer_);
+  solver.run();
+  HighsStatus return_status =
+      highsStatusFromHighsModelStatus(solver.modelstatus_);
+  model_status_ = solver.modelstatus_;
+  if (solver.solution_objective_ != kHighsInf) {
+    solution_.col_value = solver.solution_;
+    model_.lp_.a_matrix_.productQuad(solution_.row_value, solution_.col_value);
+    solution_.value_valid = true;
+  }
+  // There is no dual solution or basis
+  assert(!solution_.dual_valid);
+  assert(!basis_.valid);
+  info_.objective_function_value = solver.solution_objective_;
+  // Primal feasibility is assessed with respect to the MIP feasibility
+  // tolerance
+  const double primal_feasibility_tolerance =
+      options_.primal_feasibility_tolerance;
+  options_.primal_feasibility_tolerance = options_.mip_feasibility_tolerance;
+  getKktFailures(options_, model_, solution_, basis_, info_);
+  options_.primal_feasibility_tolerance = primal_feasibility_tolerance;
+  if (solution_.value_valid)
+    info_.max_integrality_violation = solver.integrality_violation_;
+  // Set the MIP-specific values of info_
+  info_.mip_node_count = solver.node_count_;
+  info_.mip_dual_bound = solver.dual_bound_;
+  info_.mip_gap = solver.gap_;
+  info_.qp_iteration_count = solver.total_qp_iterations_ > kHighsIInf
+                                 ? -1
+                                 : HighsInt(solver.total_qp_iterations_);
+  info_.valid = true;
+  if (model_status_ == HighsModelStatus::kOptimal)
+    checkOptimality("MIQP", return_status);
+  return return_status;
+}
+
 // Only called from Highs::postsolve
 HighsStatus Highs::callRunPostsolve(const HighsSolution& solution,
                                     const HighsBasis& basis) {
@@ -24,6 +24,7 @@
 #include "lp_data/HighsSolution.h"
 #include "lp_data/HighsStatus.h"
 #include "util/HighsCDouble.h"
+#include "util/HighsDisjointSets.h"
 #include "util/HighsMatrixUtils.h"
 #include "util/HighsSort.h"
 #include "util/HighsTimer.h"
@@ -3028,3 +3029,71 @@ void removeRowsOfCountOne(const HighsLogOptions& log_options, HighsLp& lp) {
   highsLogUser(log_options, HighsLogType::kWarning,
                "Removed %d rows of count 1\n", (int)num_row_count_1);
 }
+
+HighsInt getLpComponents(const HighsLp& lp,
+                         std::vector<HighsInt>& col_component,
+                         std::vector<HighsInt>& row_component) {
+  // Identify the connected components of the bipartite graph of
+  // columns and rows defined by the (column-wise) constraint
+  // matrix. Item iCol is column iCol, and item lp.num_col_+iRow is row
+  // iRow
+  assert(lp.a_matrix_.isColwise());
+  HighsDisjointSets<> components(lp.num_col_ + lp.num_row_);
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+    for (HighsInt iEl = lp.a_matrix_.start_[iCol];
+         iEl < lp.a_matrix_.start_[iCol + 1]; iEl++)
+      components.merge(iCol, lp.num_col_ + lp.a_matrix_.index_[iEl]);
+  }
+  // Number the components in order of their first column, and then
+  // their first row, so that the numbering is deterministic
+  std::vector<HighsInt> set_component(lp.num_col_ + lp.num_row_, -1);
+  HighsInt num_component = 0;
+  auto getComponent = [&](const HighsInt item) {
+    HighsInt set = components.getSet(item);
+    if (set_component[set] < 0) set_component[set] = num_component++;
+    return set_component[set];
+  };
+  col_component.resize(lp.num_col_);
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++)
+    col_component[iCol] = getComponent(iCol);
+  row_component.resize(lp.num_row_);
+  for (HighsInt iRow = 0; iRow < lp.num_row_; iRow++)
+    row_component[iRow] = getComponent(lp.num_col_ + iRow);
+  return num_component;
+}
+
+void getLpComponent(const HighsLp& lp, const std::vector<HighsInt>& col_set,
+                    const std::vector<HighsInt>& row_set,
+                    const std::vector<HighsInt>& row_component_index,
+                    HighsLp& component_lp) {
+  // Extract the LP whose columns and rows are col_set and row_set,
+  // where row_component_index gives the index of each row of the LP
+  // within its component. The rows of the LP with nonzeros in the
+  // columns of col_set must be in row_set
+  assert(lp.a_matrix_.isColwise());
+  component_lp.clear();
+  component_lp.num_col_ = col_set.size();
+  component_lp.num_row_ = row_set.size();
+  component_lp.sense_ = lp.sense_;
+  component_lp.offset_ = 0;
+  HighsSparseMatrix& matrix = component_lp.a_matrix_;
+  matrix.format_ = MatrixFormat::kColwise;
+  matrix.num_col_ = component_lp.num_col_;
+  matrix.num_row_ = component_lp.num_row_;
+  matrix.start_.assign(1, 0);
+  for (HighsInt iCol : col_set) {
+    component_lp.col_cost_.push_back(lp.col_cost_[iCol]);
+    component_lp.col_lower_.push_back(lp.col_lower_[iCol]);
+    component_lp.col_upper_.push_back(lp.col_upper_[iCol]);
+    for (HighsInt iEl = lp.a_matrix_.start_[iCol];
+         iEl < lp.a_matrix_.start_[iCol + 1]; iEl++) {
+      matrix.index_.push_back(row_component_index[lp.a_matrix_.index_[iEl]]);
+      matrix.value_.push_back(lp.a_matrix_.value_[iEl]);
+    }
+    matrix.start_.push_back(matrix.index_.size());
+  }
+  for (HighsInt iRow : row_set) {
+    component_lp.row_lower_.push_back(lp.row_lower_[iRow]);
+    component_lp.row_upper_.push_back(lp.row_upper_[iRow]);
+  }
+}
@@ -263,4 +263,13 @@ HighsLp withoutSemiVariables(const HighsLp& lp, HighsSolution& solution,
 
 void removeRowsOfCountOne(const HighsLogOptions& log_options, HighsLp& lp);
 
+HighsInt getLpComponents(const HighsLp& lp,
+                         std::vector<HighsInt>& col_component,
+                         std::vector<HighsInt>& row_component);
+
+void getLpComponent(const HighsLp& lp, const std::vector<HighsInt>& col_set,
+                    const std::vector<HighsInt>& row_set,
+                    const std::vector<HighsInt>& row_component_index,
+                    HighsLp& component_lp);
+
 #endif  // LP_DATA_HIGHSLPUTILS_H_
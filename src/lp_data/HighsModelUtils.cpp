@@ -1307,6 +1307,30 @@ std::string utilPresolveRuleTypeToString(const HighsInt rule_type) {
   return "????";
 }
 
+std::string utilPresolvePassTypeToString(const HighsInt pass_type) {
+  if (pass_type == kPresolvePassFastLoop) {
+    return "Fast presolve loop";
+  } else if (pass_type == kPresolvePassAggregator) {
+    return "Aggregator";
+  } else if (pass_type == kPresolvePassSparsify) {
+    return "Sparsify";
+  } else if (pass_type == kPresolvePassParallelRowsAndCols) {
+    return "Parallel rows and columns";
+  } else if (pass_type == kPresolvePassStrengthenInequalities) {
+    return "Strengthen inequalities";
+  } else if (pass_type == kPresolvePassDominatedCols) {
+    return "Dominated columns";
+  } else if (pass_type == kPresolvePassProbing) {
+    return "Probing";
+  } else if (pass_type == kPresolvePassDependentEquations) {
+    return "Dependent equations";
+  } else if (pass_type == kPresolvePassDependentFreeCols) {
+    return "Dependent free columns";
+  }
+  assert(1 == 0);
+  return "????";
+}
+
 // Deduce the HighsStatus value corresponding to a HighsModelStatus value.
 HighsStatus highsStatusFromHighsModelStatus(HighsModelStatus model_status) {
   switch (model_status) {
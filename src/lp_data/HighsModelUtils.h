@@ -95,6 +95,8 @@ std::string utilBasisValidityToString(const HighsInt basis_validity);
 
 std::string utilPresolveRuleTypeToString(const HighsInt rule_type);
 
+std::string utilPresolvePassTypeToString(const HighsInt pass_type);
+
 HighsStatus highsStatusFromHighsModelStatus(HighsModelStatus model_status);
 
 std::string statusToString(const HighsBasisStatus status, const double lower,
@@ -320,6 +320,7 @@ struct HighsOptionsStruct {
 
   std::string log_file;
   bool write_model_to_file;
+  bool keep_names;
   bool write_solution_to_file;
   HighsInt write_solution_style;
   HighsInt glpsol_cost_row_location;
@@ -349,6 +350,7 @@ struct HighsOptionsStruct {
   bool allow_unbounded_or_infeasible;
   bool use_implied_bounds_from_presolve;
   bool lp_presolve_requires_basis_postsolve;
+  bool lp_presolve_decompose;
   bool mps_parser_type_free;
   HighsInt keep_n_rows;
   HighsInt cost_scale_factor;
@@ -366,6 +368,11 @@ struct HighsOptionsStruct {
   HighsInt presolve_substitution_maxfillin;
   HighsInt presolve_rule_off;
   bool presolve_rule_logging;
+  std::string presolve_log_file;
+  double presolve_probing_time_limit;
+  double presolve_sparsify_time_limit;
+  HighsInt presolve_probing_work_limit;
+  HighsInt presolve_sparsify_work_limit;
   bool simplex_initial_condition_check;
   bool no_unnecessary_rebuild_refactor;
   double simplex_initial_condition_tolerance;
@@ -399,6 +406,7 @@ struct HighsOptionsStruct {
   // Options for MIP solver
   bool mip_detect_symmetry;
   bool mip_allow_restart;
+  bool miqp_branch_and_bound;
   HighsInt mip_max_nodes;
   HighsInt mip_max_stall_nodes;
   HighsInt mip_max_leaves;
@@ -408,11 +416,13 @@ struct HighsOptionsStruct {
   HighsInt mip_pool_soft_limit;
   HighsInt mip_pscost_minreliable;
   HighsInt mip_min_cliquetable_entries_for_parallelism;
+  bool mip_parallel_clique_extraction;
   HighsInt mip_report_level;
   double mip_feasibility_tolerance;
   double mip_rel_gap;
   double mip_abs_gap;
   double mip_heuristic_effort;
+  bool mip_heuristic_scheduling;
   double mip_min_logging_interval;
 #ifdef HIGHS_DEBUGSOL
   std::string mip_debug_solution_file;
@@ -420,6 +430,9 @@ struct HighsOptionsStruct {
   bool mip_improving_solution_save;
   bool mip_improving_solution_report_sparse;
   std::string mip_improving_solution_file;
+  std::string mip_checkpoint_file;
+  double mip_checkpoint_interval;
+  double mip_node_queue_memory_limit;
 
   // Logging callback identifiers
   HighsLogOptions log_options;
@@ -774,6 +787,12 @@ class HighsOptions : public HighsOptionsStruct {
                              advanced, &write_model_to_file, false);
     records.push_back(record_bool);
 
+    record_bool = new OptionRecordBool(
+        "keep_names",
+        "Keep the row and column names when reading a model file", advanced,
+        &keep_names, true);
+    records.push_back(record_bool);
+
     record_bool = new OptionRecordBool(
         "mip_detect_symmetry", "Whether MIP symmetry should be detected",
         advanced, &mip_detect_symmetry, true);
@@ -784,6 +803,13 @@ class HighsOptions : public HighsOptionsStruct {
                                        advanced, &mip_allow_restart, true);
     records.push_back(record_bool);
 
+    record_bool = new OptionRecordBool(
+        "miqp_branch_and_bound",
+        "Whether a convex MIQP is solved by branch-and-bound on its QP "
+        "relaxations, without presolve, propagation or cuts",
+        advanced, &miqp_branch_and_bound, false);
+    records.push_back(record_bool);
+
     record_int = new OptionRecordInt("mip_max_nodes",
                                      "MIP solver max number of nodes", advanced,
                                      &mip_max_nodes, 0, kHighsIInf, kHighsIInf);
@@ -821,6 +847,27 @@ class HighsOptions : public HighsOptionsStruct {
         advanced, &mip_improving_solution_file, kHighsFilenameDefault);
     records.push_back(record_string);
 
+    record_string = new OptionRecordString(
+        "mip_checkpoint_file",
+        "File for the checkpoint of the MIP tree search that can be used to "
+        "resume the search with Highs::resumeMip: not written for an empty "
+        "string \"\"",
+        advanced, &mip_checkpoint_file, kHighsFilenameDefault);
+    records.push_back(record_string);
+
+    record_double = new OptionRecordDouble(
+        "mip_checkpoint_interval",
+        "Time in seconds between writing checkpoints of the MIP tree search",
+        advanced, &mip_checkpoint_interval, 0, 300, kHighsInf);
+    records.push_back(record_double);
+
+    record_double = new OptionRecordDouble(
+        "mip_node_queue_memory_limit",
+        "Memory in MB that open nodes of the MIP search may use before the "
+        "nodes with the worst lower bounds are moved to a temporary file",
+        advanced, &mip_node_queue_memory_limit, 0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
+
     record_int = new OptionRecordInt(
         "mip_max_leaves", "MIP solver max number of leave nodes", advanced,
         &mip_max_leaves, 0, kHighsIInf, kHighsIInf);
@@ -870,6 +917,14 @@ class HighsOptions : public HighsOptionsStruct {
         kHighsIInf);
     records.push_back(record_int);
 
+    record_bool = new OptionRecordBool(
+        "mip_parallel_clique_extraction",
+        "Whether the rows of the MIP are scanned for cliques in parallel "
+        "once the cliquetable entries for parallelism are reached. The "
+        "cliques found may differ from those of the serial scan",
+        advanced, &mip_parallel_clique_extraction, false);
+    records.push_back(record_bool);
+
     record_int =
         new OptionRecordInt("mip_report_level", "MIP solver reporting level",
                             now_advanced, &mip_report_level, 0, 1, 2);
@@ -885,6 +940,13 @@ class HighsOptions : public HighsOptionsStruct {
         &mip_heuristic_effort, 0.0, 0.05, 1.0);
     records.push_back(record_double);
 
+    record_bool = new OptionRecordBool(
+        "mip_heuristic_scheduling",
+        "Whether RENS and RINS are called in the MIP tree search with a "
+        "probability that depends on their success rate",
+        advanced, &mip_heuristic_scheduling, false);
+    records.push_back(record_bool);
+
     record_double = new OptionRecordDouble(
         "mip_rel_gap",
         "Tolerance on relative gap, |ub-lb|/|ub|, to determine whether "
@@ -988,6 +1050,13 @@ class HighsOptions : public HighsOptionsStruct {
         advanced, &lp_presolve_requires_basis_postsolve, true);
     records.push_back(record_bool);
 
+    record_bool = new OptionRecordBool(
+        "lp_presolve_decompose",
+        "Solve the independent blocks of a presolved LP as separate LPs in "
+        "parallel",
+        advanced, &lp_presolve_decompose, false);
+    records.push_back(record_bool);
+
     record_bool = new OptionRecordBool("mps_parser_type_free",
                                        "Use the free format MPS file reader",
                                        advanced, &mps_parser_type_free, true);
@@ -1153,6 +1222,40 @@ class HighsOptions : public HighsOptionsStruct {
         advanced, &presolve_rule_logging, false);
     records.push_back(record_bool);
 
+    record_string = new OptionRecordString(
+        "presolve_log_file",
+        "File for a JSON report of the presolve pass and rule statistics, "
+        "with the rule statistics only for LPs: not reported for an empty "
+        "string \"\"",
+        advanced, &presolve_log_file, kHighsFilenameDefault);
+    records.push_back(record_string);
+
+    record_double = new OptionRecordDouble(
+        "presolve_probing_time_limit",
+        "Time limit for each call of probing in presolve", advanced,
+        &presolve_probing_time_limit, 0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
+
+    record_double = new OptionRecordDouble(
+        "presolve_sparsify_time_limit",
+        "Time limit for each call of sparsify in presolve", advanced,
+        &presolve_sparsify_time_limit, 0, kHighsInf, kHighsInf);
+    records.push_back(record_double);
+
+    record_int = new OptionRecordInt(
+        "presolve_probing_work_limit",
+        "Limit on the number of columns probed in each call of probing in "
+        "presolve",
+        advanced, &presolve_probing_work_limit, 0, kHighsIInf, kHighsIInf);
+    records.push_back(record_int);
+
+    record_int = new OptionRecordInt(
+        "presolve_sparsify_work_limit",
+        "Limit on the number of equations used in each call of sparsify in "
+        "presolve",
+        advanced, &presolve_sparsify_work_limit, 0, kHighsIInf, kHighsIInf);
+    records.push_back(record_int);
+
     record_int = new OptionRecordInt(
         "presolve_substitution_maxfillin",
         "Maximal fillin allowed for substitutions in presolve", advanced,
@@ -680,7 +680,7 @@ HighsStatus ipxSolutionToHighsSolution(
     const std::vector<double>& ipx_x, const std::vector<double>& ipx_slack_vars,
     const std::vector<double>& ipx_y, const std::vector<double>& ipx_zl,
     const std::vector<double>& ipx_zu, const HighsModelStatus model_status,
-    HighsSolution& highs_solution) {
+    HighsSolution& highs_solution, const bool is_qp) {
   // Resize the HighsSolution
   highs_solution.col_value.resize(lp.num_col_);
   highs_solution.row_value.resize(lp.num_row_);
@@ -762,7 +762,9 @@ HighsStatus ipxSolutionToHighsSolution(
       "ipxSolutionToHighsSolution: Norm of delta     row values is %10.4g\n",
       delta_norm);
   const bool force_dual_feasibility = false;  // true;
-  const bool minimal_truncation = true;
+  // For a QP, the dual values depend on the primal values, so
+  // truncating either of them can only introduce dual residuals
+  const bool minimal_truncation = !is_qp;
   if (model_status == HighsModelStatus::kOptimal &&
       (force_dual_feasibility || minimal_truncation)) {
     double primal_truncation_norm = 0;
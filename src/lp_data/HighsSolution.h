@@ -107,7 +107,7 @@ HighsStatus ipxSolutionToHighsSolution(
     const std::vector<double>& ipx_x, const std::vector<double>& ipx_slack_vars,
     const std::vector<double>& ipx_y, const std::vector<double>& ipx_zl,
     const std::vector<double>& ipx_zu, const HighsModelStatus model_status,
-    HighsSolution& highs_solution);
+    HighsSolution& highs_solution, const bool is_qp = false);
 
 HighsStatus ipxBasicSolutionToHighsBasicSolution(
     const HighsLogOptions& log_options, const HighsLp& lp,
@@ -839,13 +839,129 @@ void HighsCliqueTable::removeClique(HighsInt cliqueid) {
   numEntries -= len;
 }
 
-void HighsCliqueTable::extractCliques(
-    const HighsMipSolver& mipsolver, std::vector<HighsInt>& inds,
-    std::vector<double>& vals, std::vector<int8_t>& complementation, double rhs,
-    HighsInt nbin, std::vector<HighsInt>& perm, std::vector<CliqueVar>& clique,
-    double feastol) {
-  HighsImplications& implics = mipsolver.mipdata_->implications;
-  HighsDomain& globaldom = mipsolver.mipdata_->domain;
+// Scratch space for transforming a single row into the form from which
+// cliques are extracted
+struct HighsCliqueTable::RowWorkspace {
+  std::vector<HighsInt> inds;
+  std::vector<double> vals;
+  std::vector<HighsInt> perm;
+  std::vector<int8_t> complementation;
+  std::vector<CliqueVar> clique;
+  HighsHashTable<HighsInt, double> entries;
+};
+
+namespace {
+// Receives the cliques and variable bounds found in a row and inserts them
+// right away, so that the following rows see the fixings they cause.
+struct CliqueInsertion {
+  HighsCliqueTable& cliquetable;
+  const HighsMipSolver& mipsolver;
+
+  bool addClique(HighsCliqueTable::CliqueVar* cliquevars,
+                 HighsInt numcliquevars, bool equality, HighsInt origin,
+                 bool /*transformed*/) {
+    cliquetable.addClique(mipsolver, cliquevars, numcliquevars, equality,
+                          origin);
+    return !mipsolver.mipdata_->domain.infeasible();
+  }
+
+  void addVLB(HighsInt col, HighsInt vlbcol, double coef, double constant) {
+    mipsolver.mipdata_->implications.addVLB(col, vlbcol, coef, constant);
+  }
+
+  void addVUB(HighsInt col, HighsInt vubcol, double coef, double constant) {
+    mipsolver.mipdata_->implications.addVUB(col, vubcol, coef, constant);
+  }
+};
+
+// Collects the cliques and variable bounds found in a block of rows, so that
+// the rows can be scanned in parallel and the results are inserted in the
+// order of the rows afterwards.
+struct CliqueBuffer {
+  struct Item {
+    // a clique with its variables in cliquevars[start, end), or the variable
+    // bound varbounds[start] if end is -1
+    HighsInt start;
+    HighsInt end;
+    HighsInt origin;
+    bool equality;
+    bool transformed;
+  };
+
+  struct VarBound {
+    HighsInt col;
+    HighsInt bincol;
+    double coef;
+    double constant;
+    bool upper;
+  };
+
+  std::vector<HighsCliqueTable::CliqueVar> cliquevars;
+  std::vector<VarBound> varbounds;
+  std::vector<Item> items;
+
+  bool addClique(HighsCliqueTable::CliqueVar* clqvars, HighsInt numclqvars,
+                 bool equality, HighsInt origin, bool transformed) {
+    HighsInt start = cliquevars.size();
+    cliquevars.insert(cliquevars.end(), clqvars, clqvars + numclqvars);
+    items.push_back(
+        Item{start, start + numclqvars, origin, equality, transformed});
+    return true;
+  }
+
+  void addVLB(HighsInt col, HighsInt vlbcol, double coef, double constant) {
+    items.push_back(Item{(HighsInt)varbounds.size(), -1, -1, false, true});
+    varbounds.push_back(VarBound{col, vlbcol, coef, constant, false});
+  }
+
+  void addVUB(HighsInt col, HighsInt vubcol, double coef, double constant) {
+    items.push_back(Item{(HighsInt)varbounds.size(), -1, -1, false, true});
+    varbounds.push_back(VarBound{col, vubcol, coef, constant, true});
+  }
+
+  bool insert(HighsCliqueTable& cliquetable, const HighsMipSolver& mipsolver) {
+    HighsImplications& implics = mipsolver.mipdata_->implications;
+    bool feasible = true;
+    for (const Item& item : items) {
+      // as in the serial scan, rows are only transformed while the clique
+      // table has room left
+      if (item.transformed && cliquetable.isFull()) continue;
+
+      if (item.end == -1) {
+        const VarBound& vb = varbounds[item.start];
+        if (vb.upper)
+          implics.addVUB(vb.col, vb.bincol, vb.coef, vb.constant);
+        else
+          implics.addVLB(vb.col, vb.bincol, vb.coef, vb.constant);
+        continue;
+      }
+
+      cliquetable.addClique(mipsolver, cliquevars.data() + item.start,
+                            item.end - item.start, item.equality, item.origin);
+      if (mipsolver.mipdata_->domain.infeasible()) {
+        feasible = false;
+        break;
+      }
+    }
+
+    cliquevars.clear();
+    varbounds.clear();
+    items.clear();
+    return feasible;
+  }
+};
+}  // namespace
+
+template <typename Sink>
+bool HighsCliqueTable::extractCliques(const HighsMipSolver& mipsolver,
+                                      RowWorkspace& ws, double rhs,
+                                      double feastol, Sink& sink) const {
+  const HighsDomain& globaldom = mipsolver.mipdata_->domain;
+  const std::vector<HighsInt>& inds = ws.inds;
+  const std::vector<double>& vals = ws.vals;
+  const std::vector<int8_t>& complementation = ws.complementation;
+  std::vector<HighsInt>& perm = ws.perm;
+  std::vector<CliqueVar>& clique = ws.clique;
 
   perm.resize(inds.size());
   std::iota(perm.begin(), perm.end(), 0);
@@ -853,7 +969,7 @@ void HighsCliqueTable::extractCliques(
   auto binaryend = std::partition(perm.begin(), perm.end(), [&](HighsInt pos) {
     return globaldom.isBinary(inds[pos]);
   });
-  nbin = binaryend - perm.begin();
+  HighsInt nbin = binaryend - perm.begin();
   HighsInt ntotal = (HighsInt)perm.size();
 
   // if not all variables are binary, we extract variable upper and lower bounds
@@ -888,10 +1004,10 @@ void HighsCliqueTable::extractCliques(
 
           if (complementation[perm[j]] == -1) {
             constant -= globaldom.col_upper_[col];
-            implics.addVLB(col, bincol, -double(coef), -double(constant));
+            sink.addVLB(col, bincol, -double(coef), -double(constant));
           } else {
             constant += globaldom.col_lower_[col];
-            implics.addVUB(col, bincol, double(coef), double(constant));
+            sink.addVUB(col, bincol, double(coef), double(constant));
           }
         }
       }
@@ -899,13 +1015,13 @@ void HighsCliqueTable::extractCliques(
   }
 
   // only one binary means we do have no cliques
-  if (nbin <= 1) return;
+  if (nbin <= 1) return true;
 
   pdqsort(perm.begin(), binaryend, [&](HighsInt p1, HighsInt p2) {
     return std::make_pair(vals[p1], p1) > std::make_pair(vals[p2], p2);
   });
   // check if any cliques exists
-  if (vals[perm[0]] + vals[perm[1]] <= rhs + feastol) return;
+  if (vals[perm[0]] + vals[perm[1]] <= rhs + feastol) return true;
 
   // check if this is a set packing constraint (or easily transformable
   // into one)
@@ -927,11 +1043,9 @@ void HighsCliqueTable::extractCliques(
         clique.emplace_back(inds[pos], 1);
     }
 
-    addClique(mipsolver, clique.data(), nbin);
-    if (globaldom.infeasible()) return;
     // printf("extracted this clique:\n");
     // printClique(clique);
-    return;
+    return sink.addClique(clique.data(), nbin, false, kHighsIInf, true);
   }
 
   for (HighsInt k = nbin - 1; k != 0; --k) {
@@ -965,14 +1079,17 @@ void HighsCliqueTable::extractCliques(
       // if (clique.size() > 2) runCliqueSubsumption(globaldom, clique);
       // runCliqueMerging(globaldom, clique);
       // if (clique.size() >= 2) {
-      addClique(mipsolver, clique.data(), clique.size());
-      if (globaldom.infeasible()) return;
+      if (!sink.addClique(clique.data(), clique.size(), false, kHighsIInf,
+                          true))
+        return false;
       //}
     }
 
     // further cliques are just subsets of this clique
-    if (cliqueend == perm.begin() + k) return;
+    if (cliqueend == perm.begin() + k) return true;
   }
+
+  return true;
 }
 
 void HighsCliqueTable::cliquePartition(std::vector<CliqueVar>& clqVars,
@@ -1267,171 +1384,229 @@ void HighsCliqueTable::extractCliquesFromCut(const HighsMipSolver& mipsolver,
   }
 }
 
-void HighsCliqueTable::extractCliques(HighsMipSolver& mipsolver,
-                                      bool transformRows) {
-  std::vector<HighsInt> inds;
-  std::vector<double> vals;
-  std::vector<HighsInt> perm;
-  std::vector<int8_t> complementation;
-  std::vector<CliqueVar> clique;
-  HighsHashTable<HighsInt, double> entries;
+template <typename Sink>
+bool HighsCliqueTable::extractRowCliques(const HighsMipSolver& mipsolver,
+                                         HighsInt i, bool transformRows,
+                                         RowWorkspace& ws, Sink& sink) const {
+  std::vector<HighsInt>& inds = ws.inds;
+  std::vector<double>& vals = ws.vals;
+  std::vector<int8_t>& complementation = ws.complementation;
+  std::vector<CliqueVar>& clique = ws.clique;
+  HighsHashTable<HighsInt, double>& entries = ws.entries;
   double offset;
 
   double rhs;
 
-  HighsDomain& globaldom = mipsolver.mipdata_->domain;
-
-  for (HighsInt i = 0; i != mipsolver.numRow(); ++i) {
-    HighsInt start = mipsolver.mipdata_->ARstart_[i];
-    HighsInt end = mipsolver.mipdata_->ARstart_[i + 1];
-
-    if (mipsolver.mipdata_->postSolveStack.getOrigRowIndex(i) >=
-        mipsolver.orig_model_->num_row_)
-      break;
-
-    // catch set packing and partitioning constraints that already have the form
-    // of a clique without transformations and add those cliques with the rows
-    // being recorded
-    if (mipsolver.rowUpper(i) == 1.0) {
-      bool issetppc = true;
+  const HighsDomain& globaldom = mipsolver.mipdata_->domain;
 
-      clique.clear();
+  HighsInt start = mipsolver.mipdata_->ARstart_[i];
+  HighsInt end = mipsolver.mipdata_->ARstart_[i + 1];
 
-      for (HighsInt j = start; j != end; ++j) {
-        HighsInt col = mipsolver.mipdata_->ARindex_[j];
-        if (globaldom.col_upper_[col] == 0.0 &&
-            globaldom.col_lower_[col] == 0.0)
-          continue;
-        if (!globaldom.isBinary(col)) {
-          issetppc = false;
-          break;
-        }
+  // catch set packing and partitioning constraints that already have the form
+  // of a clique without transformations and add those cliques with the rows
+  // being recorded
+  if (mipsolver.rowUpper(i) == 1.0) {
+    bool issetppc = true;
 
-        if (mipsolver.mipdata_->ARvalue_[j] != 1.0) {
-          issetppc = false;
-          break;
-        }
+    clique.clear();
 
-        clique.emplace_back(col, 1);
+    for (HighsInt j = start; j != end; ++j) {
+      HighsInt col = mipsolver.mipdata_->ARindex_[j];
+      if (globaldom.col_upper_[col] == 0.0 && globaldom.col_lower_[col] == 0.0)
+        continue;
+      if (!globaldom.isBinary(col)) {
+        issetppc = false;
+        break;
       }
 
-      if (issetppc) {
-        bool equality = mipsolver.rowLower(i) == 1.0;
-        addClique(mipsolver, clique.data(), clique.size(), equality, i);
-        if (globaldom.infeasible()) return;
-        continue;
+      if (mipsolver.mipdata_->ARvalue_[j] != 1.0) {
+        issetppc = false;
+        break;
       }
-    }
-    if (!transformRows || isFull()) continue;
 
-    offset = 0;
-    for (HighsInt j = start; j != end; ++j) {
-      HighsInt col = mipsolver.mipdata_->ARindex_[j];
-      double val = mipsolver.mipdata_->ARvalue_[j];
+      clique.emplace_back(col, 1);
+    }
 
-      resolveSubstitution(col, val, offset);
-      entries[col] += val;
+    if (issetppc) {
+      bool equality = mipsolver.rowLower(i) == 1.0;
+      return sink.addClique(clique.data(), clique.size(), equality, i, false);
     }
+  }
+  if (!transformRows || isFull()) return true;
+
+  offset = 0;
+  for (HighsInt j = start; j != end; ++j) {
+    HighsInt col = mipsolver.mipdata_->ARindex_[j];
+    double val = mipsolver.mipdata_->ARvalue_[j];
 
-    if (mipsolver.rowUpper(i) != kHighsInf) {
-      rhs = mipsolver.rowUpper(i) - offset;
-      inds.clear();
-      vals.clear();
-      complementation.clear();
-      bool freevar = false;
-      HighsInt nbin = 0;
+    resolveSubstitution(col, val, offset);
+    entries[col] += val;
+  }
 
-      for (const auto& entry : entries) {
-        HighsInt col = entry.key();
-        double val = entry.value();
+  bool feasible = true;
 
-        if (std::abs(val) < mipsolver.mipdata_->epsilon) continue;
+  if (mipsolver.rowUpper(i) != kHighsInf) {
+    rhs = mipsolver.rowUpper(i) - offset;
+    inds.clear();
+    vals.clear();
+    complementation.clear();
+    bool freevar = false;
+    HighsInt nbin = 0;
 
-        if (globaldom.isBinary(col)) ++nbin;
+    for (const auto& entry : entries) {
+      HighsInt col = entry.key();
+      double val = entry.value();
 
-        if (val < 0) {
-          if (globaldom.col_upper_[col] == kHighsInf) {
-            freevar = true;
-            break;
-          }
+      if (std::abs(val) < mipsolver.mipdata_->epsilon) continue;
 
-          vals.push_back(-val);
-          inds.push_back(col);
-          complementation.push_back(-1);
-          rhs -= val * globaldom.col_upper_[col];
-        } else {
-          if (globaldom.col_lower_[col] == -kHighsInf) {
-            freevar = true;
-            break;
-          }
+      if (globaldom.isBinary(col)) ++nbin;
 
-          vals.push_back(val);
-          inds.push_back(col);
-          complementation.push_back(1);
-          rhs -= val * globaldom.col_lower_[col];
+      if (val < 0) {
+        if (globaldom.col_upper_[col] == kHighsInf) {
+          freevar = true;
+          break;
         }
-      }
 
-      if (!freevar && nbin != 0) {
-        // printf("extracting cliques from this row:\n");
-        // printRow(globaldom, inds.data(), vals.data(), inds.size(),
-        //         -kHighsInf, rhs);
-        extractCliques(mipsolver, inds, vals, complementation, rhs, nbin, perm,
-                       clique, mipsolver.mipdata_->feastol);
-        if (globaldom.infeasible()) return;
+        vals.push_back(-val);
+        inds.push_back(col);
+        complementation.push_back(-1);
+        rhs -= val * globaldom.col_upper_[col];
+      } else {
+        if (globaldom.col_lower_[col] == -kHighsInf) {
+          freevar = true;
+          break;
+        }
+
+        vals.push_back(val);
+        inds.push_back(col);
+        complementation.push_back(1);
+        rhs -= val * globaldom.col_lower_[col];
       }
     }
 
-    if (mipsolver.rowLower(i) != -kHighsInf) {
-      rhs = -mipsolver.rowLower(i) + offset;
-      inds.clear();
-      vals.clear();
-      complementation.clear();
-      bool freevar = false;
-      HighsInt nbin = 0;
-
-      for (const auto& entry : entries) {
-        HighsInt col = entry.key();
-        double val = -entry.value();
-        if (std::abs(val) < mipsolver.mipdata_->epsilon) continue;
-
-        if (globaldom.isBinary(col)) ++nbin;
-
-        if (val < 0) {
-          if (globaldom.col_upper_[col] == kHighsInf) {
-            freevar = true;
-            break;
-          }
+    if (!freevar && nbin != 0) {
+      // printf("extracting cliques from this row:\n");
+      // printRow(globaldom, inds.data(), vals.data(), inds.size(),
+      //         -kHighsInf, rhs);
+      feasible = extractCliques(mipsolver, ws, rhs,
+                                mipsolver.mipdata_->feastol, sink);
+    }
+  }
 
-          vals.push_back(-val);
-          inds.push_back(col);
-          complementation.push_back(-1);
-          rhs -= val * globaldom.col_upper_[col];
-        } else {
-          if (globaldom.col_lower_[col] == -kHighsInf) {
-            freevar = true;
-            break;
-          }
+  if (feasible && mipsolver.rowLower(i) != -kHighsInf) {
+    rhs = -mipsolver.rowLower(i) + offset;
+    inds.clear();
+    vals.clear();
+    complementation.clear();
+    bool freevar = false;
+    HighsInt nbin = 0;
 
-          vals.push_back(val);
-          inds.push_back(col);
-          complementation.push_back(1);
-          rhs -= val * globaldom.col_lower_[col];
+    for (const auto& entry : entries) {
+      HighsInt col = entry.key();
+      double val = -entry.value();
+      if (std::abs(val) < mipsolver.mipdata_->epsilon) continue;
+
+      if (globaldom.isBinary(col)) ++nbin;
+
+      if (val < 0) {
+        if (globaldom.col_upper_[col] == kHighsInf) {
+          freevar = true;
+          break;
         }
-      }
 
-      if (!freevar && nbin != 0) {
-        // printf("extracting cliques from this row:\n");
-        // printRow(globaldom, inds.data(), vals.data(), inds.size(),
-        //         -kHighsInf, rhs);
-        extractCliques(mipsolver, inds, vals, complementation, rhs, nbin, perm,
-                       clique, mipsolver.mipdata_->feastol);
-        if (globaldom.infeasible()) return;
+        vals.push_back(-val);
+        inds.push_back(col);
+        complementation.push_back(-1);
+        rhs -= val * globaldom.col_upper_[col];
+      } else {
+        if (globaldom.col_lower_[col] == -kHighsInf) {
+          freevar = true;
+          break;
+        }
+
+        vals.push_back(val);
+        inds.push_back(col);
+        complementation.push_back(1);
+        rhs -= val * globaldom.col_lower_[col];
       }
     }
 
-    entries.clear();
+    if (!freevar && nbin != 0) {
+      // printf("extracting cliques from this row:\n");
+      // printRow(globaldom, inds.data(), vals.data(), inds.size(),
+      //         -kHighsInf, rhs);
+      feasible = extractCliques(mipsolver, ws, rhs,
+                                mipsolver.mipdata_->feastol, sink);
+    }
+  }
+
+  entries.clear();
+  return feasible;
+}
+
+void HighsCliqueTable::extractCliques(HighsMipSolver& mipsolver,
+                                      bool transformRows) {
+  // rows beyond the rows of the original model are cuts that were added to
+  // the model and are not scanned
+  HighsInt numRow = 0;
+  while (numRow != mipsolver.numRow() &&
+         mipsolver.mipdata_->postSolveStack.getOrigRowIndex(numRow) <
+             mipsolver.orig_model_->num_row_)
+    ++numRow;
+
+  if (!mipsolver.options_mip_->mip_parallel_clique_extraction ||
+      mipsolver.mipdata_->ARstart_[numRow] < minEntriesForParallelism) {
+    RowWorkspace ws;
+    CliqueInsertion insertion{*this, mipsolver};
+    for (HighsInt i = 0; i != numRow; ++i)
+      if (!extractRowCliques(mipsolver, i, transformRows, ws, insertion))
+        return;
+    return;
+  }
+
+  // Scanning a row only reads the model, the global domain and the clique
+  // table, so blocks of rows are scanned in parallel into separate buffers.
+  // The buffers are inserted in the order of the rows afterwards. Rows are
+  // processed in rounds so that the buffered cliques do not grow beyond the
+  // limit of the clique table. Since the rows of a round are scanned before
+  // any of its cliques are inserted, the result depends on the size of the
+  // rounds, which is therefore fixed rather than depending on the number of
+  // threads. It may differ from that of the serial scan, which sees the
+  // fixings made by the insertion of each earlier row, so the parallel
+  // scan is only used if it is switched on by an option.
+  const HighsInt kRowsPerBlock = 256;
+  const HighsInt kBlocksPerRound = 16;
+  const HighsInt numBlocks = (numRow + kRowsPerBlock - 1) / kRowsPerBlock;
+  std::vector<CliqueBuffer> buffers(kBlocksPerRound);
+
+  for (HighsInt roundStart = 0; roundStart < numBlocks;
+       roundStart += kBlocksPerRound) {
+    HighsInt roundEnd = std::min(numBlocks, roundStart + kBlocksPerRound);
+    highs::parallel::for_each(
+        roundStart, roundEnd, [&](HighsInt start, HighsInt end) {
+          RowWorkspace ws;
+          for (HighsInt block = start; block != end; ++block) {
+            CliqueBuffer& buffer = buffers[block - roundStart];
+            HighsInt rowEnd = std::min(numRow, (block + 1) * kRowsPerBlock);
+            for (HighsInt i = block * kRowsPerBlock; i != rowEnd; ++i)
+              extractRowCliques(mipsolver, i, transformRows, ws, buffer);
+          }
+        });
+
+    for (HighsInt block = roundStart; block != roundEnd; ++block)
+      if (!buffers[block - roundStart].insert(*this, mipsolver)) return;
+  }
+}
+
+std::vector<std::vector<HighsCliqueTable::CliqueVar>>
+HighsCliqueTable::getCliques() const {
+  std::vector<std::vector<CliqueVar>> cliqueList;
+  for (const Clique& clique : cliques) {
+    if (clique.start == -1) continue;
+    cliqueList.emplace_back(cliqueentries.begin() + clique.start,
+                            cliqueentries.begin() + clique.end);
   }
+  return cliqueList;
 }
 
 void HighsCliqueTable::extractObjCliques(HighsMipSolver& mipsolver) {
@@ -140,11 +140,16 @@ class HighsCliqueTable {
   void bronKerboschRecurse(BronKerboschData& data, HighsInt Plen,
                            const CliqueVar* X, HighsInt Xlen) const;
 
-  void extractCliques(const HighsMipSolver& mipsolver,
-                      std::vector<HighsInt>& inds, std::vector<double>& vals,
-                      std::vector<int8_t>& complementation, double rhs,
-                      HighsInt nbin, std::vector<HighsInt>& perm,
-                      std::vector<CliqueVar>& clique, double feastol);
+  struct RowWorkspace;
+
+  template <typename Sink>
+  bool extractCliques(const HighsMipSolver& mipsolver, RowWorkspace& ws,
+                      double rhs, double feastol, Sink& sink) const;
+
+  template <typename Sink>
+  bool extractRowCliques(const HighsMipSolver& mipsolver, HighsInt row,
+                         bool transformRows, RowWorkspace& ws,
+                         Sink& sink) const;
 
   void processInfeasibleVertices(HighsDomain& domain);
 
@@ -308,6 +313,9 @@ class HighsCliqueTable {
 
   HighsInt numCliques() const { return cliques.size() - freeslots.size(); }
 
+  /// the entries of each clique, in the order of the clique identifiers
+  std::vector<std::vector<CliqueVar>> getCliques() const;
+
   HighsInt numCliques(CliqueVar v) const { return numcliquesvar[v.index()]; }
 
   HighsInt numCliques(HighsInt col, bool val) const {
@@ -18,6 +18,7 @@
 #include "mip/HighsDomain.h"
 #include "mip/HighsLpRelaxation.h"
 #include "mip/HighsMipSolverData.h"
+#include "parallel/HighsParallel.h"
 #include "util/HighsCDouble.h"
 #include "util/HighsHash.h"
 
@@ -186,6 +187,64 @@ void HighsCutPool::separate(const std::vector<double>& sol, HighsDomain& domain,
     --agelim;
   }
 
+  // compute the violations and efficacy scores of all cuts that are not in
+  // the LP in one batch. This only reads the pool, so it is done in parallel
+  // before the cuts are aged sequentially below.
+  std::vector<double> violation(nrows);
+  std::vector<double> score(nrows);
+  highs::parallel::for_each(
+      0, nrows,
+      [&](HighsInt rowStart, HighsInt rowEnd) {
+        for (HighsInt i = rowStart; i < rowEnd; ++i) {
+          // cuts with an age of -1 are already in the LP and are therefore
+          // skipped
+          if (ages_[i] < 0) continue;
+
+          HighsInt start = matrix_.getRowStart(i);
+          HighsInt end = matrix_.getRowEnd(i);
+
+          double viol(-rhs_[i]);
+
+          for (HighsInt j = start; j != end; ++j) {
+            HighsInt col = ARindex[j];
+            double solval = sol[col];
+
+            viol += ARvalue[j] * solval;
+          }
+
+          violation[i] = viol;
+          if (viol <= feastol) continue;
+
+          // compute the norm only for those entries that do not sit at their
+          // minimal activity in the current solution this avoids the
+          // phenomenon that the traditional efficacy gets weaker for stronger
+          // cuts E.g. when considering a clique cut which has additional
+          // entries whose value in the current solution is 0 then the
+          // efficacy gets lower for each such entry even though the cut
+          // dominates the clique cut where all those entries are relaxed out.
+          HighsCDouble rownorm = 0.0;
+          HighsInt numActiveNzs = 0;
+          for (HighsInt j = start; j != end; ++j) {
+            HighsInt col = ARindex[j];
+            double solval = sol[col];
+            if (ARvalue[j] > 0) {
+              if (solval > domain.col_lower_[col] + feastol) {
+                rownorm += ARvalue[j] * ARvalue[j];
+                numActiveNzs += 1;
+              }
+            } else {
+              if (solval < domain.col_upper_[col] - feastol) {
+                rownorm += ARvalue[j] * ARvalue[j];
+                numActiveNzs += 1;
+              }
+            }
+          }
+
+          score[i] = viol / (numActiveNzs * sqrt(double(rownorm)));
+        }
+      },
+      1000);
+
   for (HighsInt i = 0; i < nrows; ++i) {
     // cuts with an age of -1 are already in the LP and are therefore skipped
     if (ages_[i] < 0) continue;
@@ -193,21 +252,12 @@ void HighsCutPool::separate(const std::vector<double>& sol, HighsDomain& domain,
     HighsInt start = matrix_.getRowStart(i);
     HighsInt end = matrix_.getRowEnd(i);
 
-    double viol(-rhs_[i]);
-
-    for (HighsInt j = start; j != end; ++j) {
-      HighsInt col = ARindex[j];
-      double solval = sol[col];
-
-      viol += ARvalue[j] * solval;
-    }
-
     // if the cut is not violated more than feasibility tolerance
     // we skip it and increase its age, otherwise we reset its age
     ageDistribution[ages_[i]] -= 1;
     bool isPropagated = matrix_.columnsLinked(i);
     if (isPropagated) propRows.erase(std::make_pair(ages_[i], i));
-    if (double(viol) <= feastol) {
+    if (violation[i] <= feastol) {
       ++ages_[i];
       if (ages_[i] >= agelim) {
         uint64_t h = compute_cut_hash(&ARindex[start], &ARvalue[start],
@@ -240,37 +290,10 @@ void HighsCutPool::separate(const std::vector<double>& sol, HighsDomain& domain,
       continue;
     }
 
-    // compute the norm only for those entries that do not sit at their minimal
-    // activity in the current solution this avoids the phenomenon that the
-    // traditional efficacy gets weaker for stronger cuts E.g. when considering
-    // a clique cut which has additional entries whose value in the current
-    // solution is 0 then the efficacy gets lower for each such entry even
-    // though the cut dominates the clique cut where all those entries are
-    // relaxed out.
-    HighsCDouble rownorm = 0.0;
-    HighsInt numActiveNzs = 0;
-    for (HighsInt j = start; j != end; ++j) {
-      HighsInt col = ARindex[j];
-      double solval = sol[col];
-      if (ARvalue[j] > 0) {
-        if (solval > domain.col_lower_[col] + feastol) {
-          rownorm += ARvalue[j] * ARvalue[j];
-          numActiveNzs += 1;
-        }
-      } else {
-        if (solval < domain.col_upper_[col] - feastol) {
-          rownorm += ARvalue[j] * ARvalue[j];
-          numActiveNzs += 1;
-        }
-      }
-    }
-
     ages_[i] = 0;
     ++ageDistribution[0];
     if (isPropagated) propRows.emplace(ages_[i], i);
-    double score = viol / (numActiveNzs * sqrt(double(rownorm)));
-
-    efficacious_cuts.emplace_back(score, i);
+    efficacious_cuts.emplace_back(score[i], i);
   }
   assert((HighsInt)propRows.size() == numPropRows);
   if (efficacious_cuts.empty()) return;
@@ -318,16 +341,34 @@ void HighsCutPool::separate(const std::vector<double>& sol, HighsDomain& domain,
 
   assert(cutset.empty());
 
+  // the candidate cut is scattered into a dense vector so that its
+  // parallelism to each selected cut is a plain gather over the selected
+  // cut's nonzeros instead of a merge of the two sparse rows
+  std::vector<double> denseCut(sol.size());
   for (const std::pair<double, HighsInt>& p : efficacious_cuts) {
+    HighsInt start = matrix_.getRowStart(p.second);
+    HighsInt end = matrix_.getRowEnd(p.second);
+    for (HighsInt j = start; j != end; ++j)
+      denseCut[ARindex[j]] = ARvalue[j];
+
     bool discard = false;
     double maxpar = 0.1;
     for (HighsInt k : cutset.cutindices) {
-      if (getParallelism(k, p.second) > maxpar) {
+      HighsInt kStart = matrix_.getRowStart(k);
+      HighsInt kEnd = matrix_.getRowEnd(k);
+      double dotprod = 0.0;
+      for (HighsInt j = kStart; j != kEnd; ++j)
+        dotprod += ARvalue[j] * denseCut[ARindex[j]];
+
+      if (dotprod * rownormalization_[k] * rownormalization_[p.second] >
+          maxpar) {
         discard = true;
         break;
       }
     }
 
+    for (HighsInt j = start; j != end; ++j) denseCut[ARindex[j]] = 0.0;
+
     if (discard) continue;
 
     --ageDistribution[ages_[p.second]];
@@ -405,6 +446,38 @@ void HighsCutPool::separateLpCutsAfterRestart(HighsCutSet& cutset) {
   assert((HighsInt)propRows.size() == numPropRows);
 }
 
+void HighsCutPool::getAvailableCuts(HighsCutSet& cutset) const {
+  cutset.clear();
+  HighsInt numcuts = matrix_.getNumRows();
+  HighsInt nnz = 0;
+  for (HighsInt i = 0; i != numcuts; ++i) {
+    if (ages_[i] < 0) continue;
+    cutset.cutindices.push_back(i);
+    nnz += getRowLength(i);
+  }
+
+  cutset.resize(nnz);
+
+  HighsInt offset = 0;
+  const HighsInt* ARindex = matrix_.getARindex();
+  const double* ARvalue = matrix_.getARvalue();
+  for (HighsInt i = 0; i != cutset.numCuts(); ++i) {
+    cutset.ARstart_[i] = offset;
+    HighsInt cut = cutset.cutindices[i];
+    HighsInt start = matrix_.getRowStart(cut);
+    HighsInt end = matrix_.getRowEnd(cut);
+    cutset.upper_[i] = rhs_[cut];
+
+    for (HighsInt j = start; j != end; ++j) {
+      cutset.ARvalue_[offset] = ARvalue[j];
+      cutset.ARindex_[offset] = ARindex[j];
+      ++offset;
+    }
+  }
+
+  cutset.ARstart_[cutset.numCuts()] = offset;
+}
+
 HighsInt HighsCutPool::addCut(const HighsMipSolver& mipsolver, HighsInt* Rindex,
                               double* Rvalue, HighsInt Rlen, double rhs,
                               bool integral, bool propagate,
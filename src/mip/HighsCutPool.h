@@ -136,6 +136,9 @@ class HighsCutPool {
 
   void separateLpCutsAfterRestart(HighsCutSet& cutset);
 
+  /// collect all cuts that are neither deleted nor part of the LP relaxation
+  void getAvailableCuts(HighsCutSet& cutset) const;
+
   bool cutIsIntegral(HighsInt cut) const { return (rowintegral[cut] != 0); }
 
   HighsInt getNumCuts() const {
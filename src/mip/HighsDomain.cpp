@@ -19,6 +19,7 @@
 #include "mip/HighsConflictPool.h"
 #include "mip/HighsCutPool.h"
 #include "mip/HighsMipSolverData.h"
+#include "parallel/HighsParallel.h"
 
 static double activityContributionMin(double coef, const double& lb,
                                       const double& ub) {
@@ -67,6 +68,32 @@ void HighsDomain::addConflictPool(HighsConflictPool& conflictPool) {
   conflictPoolPropagation.emplace_back(conflictPoolIndex, this, conflictPool);
 }
 
+void HighsDomain::resetCutAge(HighsCutPool* cutpool, HighsInt cut) {
+  if (deferAgeResets_)
+    deferredCutAgeResets_.emplace_back(cutpool, cut);
+  else
+    cutpool->resetAge(cut);
+}
+
+void HighsDomain::resetConflictAge(HighsConflictPool* conflictpool,
+                                   HighsInt conflict) {
+  if (deferAgeResets_)
+    deferredConflictAgeResets_.emplace_back(conflictpool, conflict);
+  else
+    conflictpool->resetAge(conflict);
+}
+
+void HighsDomain::applyDeferredAgeResets() {
+  for (const std::pair<HighsCutPool*, HighsInt>& reset :
+       deferredCutAgeResets_)
+    reset.first->resetAge(reset.second);
+  for (const std::pair<HighsConflictPool*, HighsInt>& reset :
+       deferredConflictAgeResets_)
+    reset.first->resetAge(reset.second);
+  deferredCutAgeResets_.clear();
+  deferredConflictAgeResets_.clear();
+}
+
 void HighsDomain::ConflictPoolPropagation::linkWatchedLiteral(
     HighsInt linkPos) {
   assert(watchedLiterals_[linkPos].domchg.column != -1);
@@ -302,7 +329,7 @@ void HighsDomain::ConflictPoolPropagation::propagateConflict(
       domain->infeasible_reason = Reason::cut(
           domain->cutpoolpropagation.size() + conflictpoolindex, conflict);
       domain->infeasible_pos = domain->domchgstack_.size();
-      conflictpool_->resetAge(conflict);
+      domain->resetConflictAge(conflictpool_, conflict);
       // printf("conflict propagation found infeasibility\n");
       break;
     case 1: {
@@ -312,7 +339,7 @@ void HighsDomain::ConflictPoolPropagation::propagateConflict(
             domain->flip(entries[inactive[0]]),
             Reason::cut(domain->cutpoolpropagation.size() + conflictpoolindex,
                         conflict));
-        conflictpool_->resetAge(conflict);
+        domain->resetConflictAge(conflictpool_, conflict);
       }
       // printf("conflict propagation found bound change\n");
       break;
@@ -2355,6 +2382,28 @@ HighsDomainChange HighsDomain::backtrack() {
   return backtrackboundchg;
 }
 
+// Computes the bound changes implied by each of the marked rows. A row only
+// reads the column bounds and writes to its own activity, threshold and
+// bound change slots, so large batches of rows, as they occur at the root
+// node and during probing, are processed in parallel. The bound changes are
+// applied afterwards in the order of the rows, so the result does not depend
+// on whether the rows were processed in parallel.
+template <typename F>
+static void propagateRows(HighsInt numproprows, F&& propagateIndex) {
+  const HighsInt kMinParallelRows = 1024;
+  if (numproprows < kMinParallelRows || highs::parallel::num_threads() == 1) {
+    for (HighsInt k = 0; k != numproprows; ++k) propagateIndex(k);
+    return;
+  }
+
+  highs::parallel::for_each(
+      0, numproprows,
+      [&](HighsInt start, HighsInt end) {
+        for (HighsInt k = start; k != end; ++k) propagateIndex(k);
+      },
+      256);
+}
+
 bool HighsDomain::propagate() {
   std::vector<HighsInt> propagateinds;
 
@@ -2461,7 +2510,7 @@ bool HighsDomain::propagate() {
 
         // printf("numproprows (model): %" HIGHSINT_FORMAT "\n", numproprows);
 
-        for (HighsInt k = 0; k != numproprows; ++k) propagateIndex(k);
+        propagateRows(numproprows, propagateIndex);
 
         for (HighsInt k = 0; k != numproprows; ++k) {
           HighsInt i = propagateinds[k];
@@ -2527,12 +2576,12 @@ bool HighsDomain::propagate() {
 
           // printf("numproprows (cuts): %" HIGHSINT_FORMAT "\n", numproprows);
 
-          for (HighsInt k = 0; k != numproprows; ++k) propagateIndex(k);
+          propagateRows(numproprows, propagateIndex);
 
           for (HighsInt k = 0; k != numproprows; ++k) {
             HighsInt i = propagateinds[k];
             if (propRowNumChangedBounds_[k].first != 0) {
-              cutpoolprop.cutpool->resetAge(i);
+              resetCutAge(cutpoolprop.cutpool, i);
               HighsInt start = cutpoolprop.cutpool->getMatrix().getRowStart(i);
               HighsInt end = start + propRowNumChangedBounds_[k].first;
               for (HighsInt j = start; j != end && !infeasible_; ++j)
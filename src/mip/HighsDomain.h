@@ -315,6 +315,18 @@ class HighsDomain {
   Reason infeasible_reason;
   HighsInt infeasible_pos;
 
+  // When set, the ages of propagating cuts and conflicts are not reset
+  // in their pools, which are shared, but recorded. Copies of a domain
+  // do not inherit this
+  bool deferAgeResets_ = false;
+  std::vector<std::pair<HighsCutPool*, HighsInt>> deferredCutAgeResets_;
+  std::vector<std::pair<HighsConflictPool*, HighsInt>>
+      deferredConflictAgeResets_;
+
+  void resetCutAge(HighsCutPool* cutpool, HighsInt cut);
+
+  void resetConflictAge(HighsConflictPool* conflictpool, HighsInt conflict);
+
   void updateActivityLbChange(HighsInt col, double oldbound, double newbound);
 
   void updateActivityUbChange(HighsInt col, double oldbound, double newbound);
@@ -402,6 +414,13 @@ class HighsDomain {
     return *this;
   }
 
+  // Domains that are propagated concurrently must defer the age resets
+  // of cuts and conflicts, which are then applied by
+  // applyDeferredAgeResets() once no domain is being propagated
+  void setDeferAgeResets(bool defer) { deferAgeResets_ = defer; }
+
+  void applyDeferredAgeResets();
+
   void computeMinActivity(HighsInt start, HighsInt end, const HighsInt* ARindex,
                           const double* ARvalue, HighsInt& ninfmin,
                           HighsCDouble& activitymin);
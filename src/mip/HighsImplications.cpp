@@ -13,49 +13,33 @@
 #include "../extern/pdqsort/pdqsort.h"
 #include "mip/HighsCliqueTable.h"
 #include "mip/HighsMipSolverData.h"
+#include "parallel/HighsParallel.h"
 
-bool HighsImplications::computeImplications(HighsInt col, bool val) {
-  HighsDomain& globaldomain = mipsolver.mipdata_->domain;
-  HighsCliqueTable& cliquetable = mipsolver.mipdata_->cliquetable;
-  globaldomain.propagate();
-  if (globaldomain.infeasible() || globaldomain.isFixed(col)) return true;
-  const auto& domchgstack = globaldomain.getDomainChangeStack();
-  const auto& domchgreason = globaldomain.getDomainChangeReason();
-  HighsInt changedend = globaldomain.getChangedCols().size();
+bool HighsImplications::probeLiteral(HighsDomain& domain, HighsInt col,
+                                     bool val,
+                                     std::vector<HighsDomainChange>& implics,
+                                     HighsInt& numInferences) const {
+  const auto& domchgstack = domain.getDomainChangeStack();
+  const auto& domchgreason = domain.getDomainChangeReason();
+  HighsInt changedend = domain.getChangedCols().size();
 
   HighsInt stackimplicstart = domchgstack.size() + 1;
-  HighsInt numImplications = -stackimplicstart;
   if (val)
-    globaldomain.changeBound(HighsBoundType::kLower, col, 1);
+    domain.changeBound(HighsBoundType::kLower, col, 1);
   else
-    globaldomain.changeBound(HighsBoundType::kUpper, col, 0);
+    domain.changeBound(HighsBoundType::kUpper, col, 0);
 
-  if (globaldomain.infeasible()) {
-    globaldomain.backtrack();
-    globaldomain.clearChangedCols(changedend);
-    cliquetable.vertexInfeasible(globaldomain, col, val);
-
-    return true;
-  }
-
-  globaldomain.propagate();
-
-  if (globaldomain.infeasible()) {
-    globaldomain.backtrack();
-    globaldomain.clearChangedCols(changedend);
-
-    cliquetable.vertexInfeasible(globaldomain, col, val);
+  if (!domain.infeasible()) domain.propagate();
 
+  if (domain.infeasible()) {
+    domain.backtrack();
+    domain.clearChangedCols(changedend);
     return true;
   }
 
   HighsInt stackimplicend = domchgstack.size();
-  numImplications += stackimplicend;
-  mipsolver.mipdata_->pseudocost.addInferenceObservation(col, numImplications,
-                                                         val);
-
-  std::vector<HighsDomainChange> implics;
-  implics.reserve(numImplications);
+  numInferences = stackimplicend - stackimplicstart;
+  implics.reserve(numInferences);
 
   HighsInt numEntries = mipsolver.mipdata_->cliquetable.getNumEntries();
   HighsInt maxEntries = 100000 + mipsolver.numNonzero();
@@ -68,8 +52,124 @@ bool HighsImplications::computeImplications(HighsInt col, bool val) {
     implics.push_back(domchgstack[i]);
   }
 
-  globaldomain.backtrack();
-  globaldomain.clearChangedCols(changedend);
+  domain.backtrack();
+  domain.clearChangedCols(changedend);
+
+  return false;
+}
+
+bool HighsImplications::takePrefetchedImplications(
+    HighsInt col, bool val, std::vector<HighsDomainChange>& implics,
+    HighsInt& numInferences, bool& infeasible) {
+  if (prefetchedPos.empty()) return false;
+  HighsInt loc = 2 * col + val;
+  HighsInt pos = prefetchedPos[loc];
+  if (pos == -1) return false;
+  prefetchedPos[loc] = -1;
+
+  ProbingResult& result = prefetchedResults[pos];
+  if (!result.computed) return false;
+
+  numInferences = result.numInferences;
+  infeasible = result.infeasible;
+  if (infeasible) return true;
+
+  // the implications were computed on a copy of the global domain that may
+  // have been tightened since, so drop the ones which are no longer
+  // tightenings and treat a contradiction as an infeasible literal
+  const HighsDomain& globaldomain = mipsolver.mipdata_->domain;
+  const double feastol = mipsolver.mipdata_->feastol;
+  implics = std::move(result.implics);
+  HighsInt numImplics = 0;
+  for (const HighsDomainChange& implic : implics) {
+    if (implic.boundtype == HighsBoundType::kLower) {
+      if (implic.boundval > globaldomain.col_upper_[implic.column] + feastol) {
+        infeasible = true;
+        break;
+      }
+      if (implic.boundval <= globaldomain.col_lower_[implic.column]) continue;
+    } else {
+      if (implic.boundval < globaldomain.col_lower_[implic.column] - feastol) {
+        infeasible = true;
+        break;
+      }
+      if (implic.boundval >= globaldomain.col_upper_[implic.column]) continue;
+    }
+    implics[numImplics++] = implic;
+  }
+  implics.resize(numImplics);
+
+  return true;
+}
+
+void HighsImplications::prefetchImplications(
+    const std::vector<HighsInt>& cols) {
+  clearPrefetchedImplications();
+
+  HighsDomain& globaldomain = mipsolver.mipdata_->domain;
+  globaldomain.propagate();
+  if (globaldomain.infeasible()) return;
+
+  HighsInt numCols = cols.size();
+  HighsInt numTasks =
+      std::min(HighsInt{highs::parallel::num_threads()}, numCols);
+  if (numTasks <= 1) return;
+
+  prefetchedPos.assign(2 * static_cast<size_t>(mipsolver.numCol()), -1);
+  prefetchedResults.resize(2 * static_cast<size_t>(numCols));
+  for (HighsInt i = 0; i != numCols; ++i) {
+    prefetchedPos[2 * cols[i]] = 2 * i;
+    prefetchedPos[2 * cols[i] + 1] = 2 * i + 1;
+  }
+
+  // the domain copies register themselves with the cut and conflict pools,
+  // so they are created before the parallel loop. The pools are shared, so
+  // the copies only record the cuts and conflicts whose age they would reset
+  // and the resets are applied after the loop
+  std::vector<HighsDomain> localdoms(numTasks, globaldomain);
+  for (HighsDomain& localdom : localdoms) localdom.setDeferAgeResets(true);
+
+  highs::parallel::for_each(0, numTasks, [&](HighsInt start, HighsInt end) {
+    for (HighsInt task = start; task != end; ++task) {
+      HighsDomain& localdom = localdoms[task];
+      HighsInt chunkStart = task * numCols / numTasks;
+      HighsInt chunkEnd = (task + 1) * numCols / numTasks;
+      for (HighsInt i = chunkStart; i != chunkEnd; ++i) {
+        if (!localdom.isBinary(cols[i])) continue;
+        for (HighsInt val = 1; val >= 0; --val) {
+          ProbingResult& result = prefetchedResults[2 * i + val];
+          result.infeasible = probeLiteral(localdom, cols[i], val,
+                                           result.implics,
+                                           result.numInferences);
+          result.computed = true;
+        }
+      }
+    }
+  });
+
+  for (HighsDomain& localdom : localdoms) localdom.applyDeferredAgeResets();
+}
+
+bool HighsImplications::computeImplications(HighsInt col, bool val) {
+  HighsDomain& globaldomain = mipsolver.mipdata_->domain;
+  HighsCliqueTable& cliquetable = mipsolver.mipdata_->cliquetable;
+  globaldomain.propagate();
+  if (globaldomain.infeasible() || globaldomain.isFixed(col)) return true;
+
+  std::vector<HighsDomainChange> implics;
+  HighsInt numInferences = 0;
+  bool infeasible;
+  if (!takePrefetchedImplications(col, val, implics, numInferences,
+                                  infeasible))
+    infeasible = probeLiteral(globaldomain, col, val, implics, numInferences);
+
+  if (infeasible) {
+    cliquetable.vertexInfeasible(globaldomain, col, val);
+    return true;
+  }
+
+  mipsolver.mipdata_->pseudocost.addInferenceObservation(col, numInferences,
+                                                         val);
 
   // add the implications of binary variables to the clique table
   auto binstart = std::partition(implics.begin(), implics.end(),
@@ -450,6 +550,7 @@ void HighsImplications::rebuild(HighsInt ncols,
   vlbs.shrink_to_fit();
   vlbs.resize(ncols);
   numImplications = 0;
+  clearPrefetchedImplications();
   HighsInt oldncols = oldvubs.size();
 
   nextCleanupCall = mipsolver.numNonzero();
@@ -531,6 +632,18 @@ void HighsImplications::separateImpliedBounds(
         mipsolver.mipdata_->cliquetable.numNeighbourhoodQueries;
     HighsInt oldNumEntries = mipsolver.mipdata_->cliquetable.getNumEntries();
 
+    if (highs::parallel::num_threads() > 1) {
+      std::vector<HighsInt> probingCols;
+      for (std::pair<HighsInt, double> fracint :
+           lpRelaxation.getFractionalIntegers()) {
+        HighsInt col = fracint.first;
+        if (globaldomain.isBinary(col) && !implicationsCached(col, 0) &&
+            !implicationsCached(col, 1))
+          probingCols.push_back(col);
+      }
+      prefetchImplications(probingCols);
+    }
+
     for (std::pair<HighsInt, double> fracint :
          lpRelaxation.getFractionalIntegers()) {
       HighsInt col = fracint.first;
@@ -540,12 +653,15 @@ void HighsImplications::separateImpliedBounds(
         continue;
 
       if (runProbing(col, numboundchgs)) {
-        if (globaldomain.infeasible()) return;
+        if (globaldomain.infeasible()) break;
       }
 
       if (mipsolver.mipdata_->cliquetable.isFull()) break;
     }
 
+    clearPrefetchedImplications();
+    if (globaldomain.infeasible()) return;
+
     // if (!mipsolver.submip)
     //   printf("numEntries: %d, beforeProbing: %d\n",
     //          mipsolver.mipdata_->cliquetable.getNumEntries(), oldNumEntries);
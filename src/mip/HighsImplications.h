@@ -33,8 +33,27 @@ class HighsImplications {
   std::vector<Implics> implications;
   int64_t numImplications;
 
+  // implications of binary literals computed in parallel on copies of the
+  // global domain, indexed by 2 * col + val through prefetchedPos
+  struct ProbingResult {
+    std::vector<HighsDomainChange> implics;
+    HighsInt numInferences = 0;
+    bool infeasible = false;
+    bool computed = false;
+  };
+  std::vector<ProbingResult> prefetchedResults;
+  std::vector<HighsInt> prefetchedPos;
+
   bool computeImplications(HighsInt col, bool val);
 
+  bool probeLiteral(HighsDomain& domain, HighsInt col, bool val,
+                    std::vector<HighsDomainChange>& implics,
+                    HighsInt& numInferences) const;
+
+  bool takePrefetchedImplications(HighsInt col, bool val,
+                                  std::vector<HighsDomainChange>& implics,
+                                  HighsInt& numInferences, bool& infeasible);
+
  public:
   struct VarBound {
     double coef;
@@ -78,6 +97,7 @@ class HighsImplications {
     vlbs.clear();
     vlbs.shrink_to_fit();
     vlbs.resize(numcol);
+    clearPrefetchedImplications();
 
     nextCleanupCall = mipsolver.numNonzero();
   }
@@ -131,6 +151,13 @@ class HighsImplications {
 
   bool runProbing(HighsInt col, HighsInt& numReductions);
 
+  void prefetchImplications(const std::vector<HighsInt>& cols);
+
+  void clearPrefetchedImplications() {
+    prefetchedResults.clear();
+    prefetchedPos.clear();
+  }
+
   void rebuild(HighsInt ncols, const std::vector<HighsInt>& cIndex,
                const std::vector<HighsInt>& rIndex);
 
@@ -0,0 +1,209 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file mip/HighsMipCheckpoint.cpp
+ */
+
+#include "mip/HighsMipCheckpoint.h"
+
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+
+#include "lp_data/HighsLp.h"
+#include "util/HighsHash.h"
+
+static const char* const kCheckpointHeader = "HiGHS_MIP_checkpoint_v1";
+
+uint64_t HighsMipCheckpoint::computeModelHash(const HighsLp& model) {
+  std::vector<uint64_t> hashes;
+  hashes.push_back(HighsHashHelpers::vector_hash(
+      model.a_matrix_.start_.data(), model.a_matrix_.start_.size()));
+  hashes.push_back(HighsHashHelpers::vector_hash(
+      model.a_matrix_.index_.data(), model.a_matrix_.index_.size()));
+  hashes.push_back(HighsHashHelpers::vector_hash(
+      model.a_matrix_.value_.data(), model.a_matrix_.value_.size()));
+  hashes.push_back(HighsHashHelpers::vector_hash(model.col_cost_.data(),
+                                                 model.col_cost_.size()));
+  hashes.push_back(HighsHashHelpers::vector_hash(model.col_lower_.data(),
+                                                 model.col_lower_.size()));
+  hashes.push_back(HighsHashHelpers::vector_hash(model.col_upper_.data(),
+                                                 model.col_upper_.size()));
+  hashes.push_back(HighsHashHelpers::vector_hash(model.row_lower_.data(),
+                                                 model.row_lower_.size()));
+  hashes.push_back(HighsHashHelpers::vector_hash(model.row_upper_.data(),
+                                                 model.row_upper_.size()));
+  hashes.push_back(HighsHashHelpers::vector_hash(model.integrality_.data(),
+                                                 model.integrality_.size()));
+  return HighsHashHelpers::vector_hash(hashes.data(), hashes.size());
+}
+
+bool HighsMipCheckpoint::matchesModel(const HighsLp& model) const {
+  return numCol == model.num_col_ && numRow == model.num_row_ &&
+         modelHash == computeModelHash(model);
+}
+
+bool HighsMipCheckpoint::write(const std::string& filename) const {
+  // write to a temporary file first, so that an interrupted write does not
+  // destroy the previous checkpoint
+  const std::string tmpFilename = filename + ".tmp";
+  FILE* file = fopen(tmpFilename.c_str(), "w");
+  if (file == nullptr) return false;
+
+  fprintf(file, "%s\n", kCheckpointHeader);
+  fprintf(file, "original_columns %" HIGHSINT_FORMAT "\n", origNumCol);
+  if (incumbent.empty()) {
+    fprintf(file, "incumbent 0\n");
+  } else {
+    fprintf(file, "incumbent 1 %.17g\n", incumbentObjective);
+    for (double value : incumbent) fprintf(file, "%.17g\n", value);
+  }
+
+  fprintf(file, "pseudocost %.17g %.17g %.17g %" PRId64 " %" PRId64 "\n",
+          pscost.cost_total, pscost.inferences_total, pscost.conflict_avg_score,
+          pscost.nsamplestotal, pscost.ninferencestotal);
+  for (HighsInt i = 0; i < origNumCol; ++i)
+    fprintf(file,
+            "%.17g %.17g %" HIGHSINT_FORMAT " %" HIGHSINT_FORMAT
+            " %.17g %.17g %" HIGHSINT_FORMAT " %" HIGHSINT_FORMAT
+            " %.17g %.17g\n",
+            pscost.pseudocostup[i], pscost.pseudocostdown[i],
+            pscost.nsamplesup[i], pscost.nsamplesdown[i],
+            pscost.inferencesup[i], pscost.inferencesdown[i],
+            pscost.ninferencesup[i], pscost.ninferencesdown[i],
+            pscost.conflictscoreup[i], pscost.conflictscoredown[i]);
+
+  fprintf(file,
+          "presolved_model %" HIGHSINT_FORMAT " %" HIGHSINT_FORMAT " %" PRIu64
+          "\n",
+          numCol, numRow, modelHash);
+  fprintf(file, "pruned_treeweight %.17g\n", prunedTreeweight);
+  fprintf(file, "nodes %" HIGHSINT_FORMAT "\n", (HighsInt)nodes.size());
+  for (const Node& node : nodes) {
+    fprintf(file,
+            "node %.17g %.17g %" HIGHSINT_FORMAT " %" HIGHSINT_FORMAT
+            " %" HIGHSINT_FORMAT "\n",
+            node.lower_bound, node.estimate, node.depth,
+            (HighsInt)node.domchgstack.size(), (HighsInt)node.branchings.size());
+    for (const HighsDomainChange& domchg : node.domchgstack)
+      fprintf(file, "%" HIGHSINT_FORMAT " %d %.17g\n", domchg.column,
+              (int)domchg.boundtype, domchg.boundval);
+    for (HighsInt branching : node.branchings)
+      fprintf(file, "%" HIGHSINT_FORMAT "\n", branching);
+  }
+
+  bool ok = ferror(file) == 0;
+  ok = fclose(file) == 0 && ok;
+  if (ok) ok = rename(tmpFilename.c_str(), filename.c_str()) == 0;
+  if (!ok) remove(tmpFilename.c_str());
+  return ok;
+}
+
+// doubles are read through strtod so that infinite values written by
+// fprintf are parsed correctly
+static bool readDouble(std::ifstream& in, double& value) {
+  std::string token;
+  if (!(in >> token)) return false;
+  char* end;
+  value = std::strtod(token.c_str(), &end);
+  return *end == '\0';
+}
+
+static bool readKeyword(std::ifstream& in, const char* keyword) {
+  std::string token;
+  return (in >> token) && token == keyword;
+}
+
+bool HighsMipCheckpoint::read(const std::string& filename) {
+  std::ifstream in(filename);
+  if (!in.is_open()) return false;
+
+  if (!readKeyword(in, kCheckpointHeader)) return false;
+  if (!readKeyword(in, "original_columns") || !(in >> origNumCol) ||
+      origNumCol < 0)
+    return false;
+
+  HighsInt haveIncumbent;
+  if (!readKeyword(in, "incumbent") || !(in >> haveIncumbent)) return false;
+  incumbent.clear();
+  incumbentObjective = kHighsInf;
+  if (haveIncumbent) {
+    if (!readDouble(in, incumbentObjective)) return false;
+    incumbent.resize(origNumCol);
+    for (double& value : incumbent)
+      if (!readDouble(in, value)) return false;
+  }
+
+  if (!readKeyword(in, "pseudocost") || !readDouble(in, pscost.cost_total) ||
+      !readDouble(in, pscost.inferences_total) ||
+      !readDouble(in, pscost.conflict_avg_score) ||
+      !(in >> pscost.nsamplestotal >> pscost.ninferencestotal))
+    return false;
+  pscost.pseudocostup.resize(origNumCol);
+  pscost.pseudocostdown.resize(origNumCol);
+  pscost.nsamplesup.resize(origNumCol);
+  pscost.nsamplesdown.resize(origNumCol);
+  pscost.inferencesup.resize(origNumCol);
+  pscost.inferencesdown.resize(origNumCol);
+  pscost.ninferencesup.resize(origNumCol);
+  pscost.ninferencesdown.resize(origNumCol);
+  pscost.conflictscoreup.resize(origNumCol);
+  pscost.conflictscoredown.resize(origNumCol);
+  for (HighsInt i = 0; i < origNumCol; ++i) {
+    if (!readDouble(in, pscost.pseudocostup[i]) ||
+        !readDouble(in, pscost.pseudocostdown[i]) ||
+        !(in >> pscost.nsamplesup[i] >> pscost.nsamplesdown[i]) ||
+        !readDouble(in, pscost.inferencesup[i]) ||
+        !readDouble(in, pscost.inferencesdown[i]) ||
+        !(in >> pscost.ninferencesup[i] >> pscost.ninferencesdown[i]) ||
+        !readDouble(in, pscost.conflictscoreup[i]) ||
+        !readDouble(in, pscost.conflictscoredown[i]))
+      return false;
+  }
+
+  if (!readKeyword(in, "presolved_model") ||
+      !(in >> numCol >> numRow >> modelHash))
+    return false;
+  if (!readKeyword(in, "pruned_treeweight") ||
+      !readDouble(in, prunedTreeweight))
+    return false;
+
+  HighsInt numNodes;
+  if (!readKeyword(in, "nodes") || !(in >> numNodes) || numNodes < 0)
+    return false;
+  nodes.assign(numNodes, Node());
+  for (Node& node : nodes) {
+    HighsInt numDomchgs;
+    HighsInt numBranchings;
+    if (!readKeyword(in, "node") || !readDouble(in, node.lower_bound) ||
+        !readDouble(in, node.estimate) ||
+        !(in >> node.depth >> numDomchgs >> numBranchings) || numDomchgs < 0 ||
+        numBranchings < 0)
+      return false;
+    node.domchgstack.resize(numDomchgs);
+    for (HighsDomainChange& domchg : node.domchgstack) {
+      int boundtype;
+      if (!(in >> domchg.column >> boundtype) ||
+          !readDouble(in, domchg.boundval) || domchg.column < 0 ||
+          domchg.column >= numCol)
+        return false;
+      domchg.boundtype = boundtype == (int)HighsBoundType::kLower
+                             ? HighsBoundType::kLower
+                             : HighsBoundType::kUpper;
+    }
+    node.branchings.resize(numBranchings);
+    for (HighsInt& branching : node.branchings)
+      if (!(in >> branching) || branching < 0 || branching >= numDomchgs)
+        return false;
+  }
+
+  return true;
+}
@@ -0,0 +1,62 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file mip/HighsMipCheckpoint.h
+ * @brief Checkpoint of the MIP tree search that can be written to file and
+ * used to resume the search
+ */
+
+#ifndef HIGHS_MIP_CHECKPOINT_H_
+#define HIGHS_MIP_CHECKPOINT_H_
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "lp_data/HConst.h"
+#include "mip/HighsDomainChange.h"
+#include "mip/HighsPseudocost.h"
+
+class HighsLp;
+
+struct HighsMipCheckpoint {
+  struct Node {
+    std::vector<HighsDomainChange> domchgstack;
+    std::vector<HighsInt> branchings;
+    double lower_bound;
+    double estimate;
+    HighsInt depth;
+  };
+
+  // The incumbent and the pseudocosts are stored for the columns of the
+  // original model, so that they can be used for any presolved model
+  HighsInt origNumCol = 0;
+  double incumbentObjective = kHighsInf;
+  std::vector<double> incumbent;
+  HighsPseudocostInitialization pscost;
+
+  // The open nodes refer to the columns of the presolved model, which is
+  // identified by its dimensions and a hash of its data
+  HighsInt numCol = 0;
+  HighsInt numRow = 0;
+  uint64_t modelHash = 0;
+  double prunedTreeweight = 0.0;
+  std::vector<Node> nodes;
+
+  static uint64_t computeModelHash(const HighsLp& model);
+
+  bool matchesModel(const HighsLp& model) const;
+
+  bool write(const std::string& filename) const;
+
+  bool read(const std::string& filename);
+};
+
+#endif
@@ -0,0 +1,95 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file mip/HighsMipSolutionWriter.cpp
+ * @brief Writes improving MIP solutions to file in a background thread
+ */
+#include "mip/HighsMipSolutionWriter.h"
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+#include "lp_data/HighsModelUtils.h"
+
+bool HighsMipSolutionWriter::open(const std::string& filename,
+                                  const HighsLp& lp, const bool sparse) {
+  close();
+  file_ = fopen(filename.c_str(), "w");
+  if (file_ == nullptr) return false;
+  lp_ = &lp;
+  sparse_ = sparse;
+  finish_ = false;
+  thread_ = std::thread(&HighsMipSolutionWriter::run, this);
+  return true;
+}
+
+void HighsMipSolutionWriter::write(const std::vector<double>& solution) {
+  if (file_ == nullptr) return;
+  std::vector<double> buffer;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!free_buffers_.empty()) {
+      buffer.swap(free_buffers_.back());
+      free_buffers_.pop_back();
+    }
+  }
+  // Copy the solution without holding the lock, so the writer thread
+  // can take solutions from the queue meanwhile
+  buffer.assign(solution.begin(), solution.end());
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    dequeued_.wait(lock, [this]() { return queue_.size() < kMaxQueued; });
+    queue_.push_back(std::move(buffer));
+  }
+  queued_.notify_one();
+}
+
+void HighsMipSolutionWriter::run() {
+  std::vector<double> solution;
+  while (true) {
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      if (!solution.empty()) free_buffers_.push_back(std::move(solution));
+      queued_.wait(lock, [this]() { return finish_ || !queue_.empty(); });
+      // All queued solutions are written before finishing
+      if (queue_.empty()) return;
+      solution = std::move(queue_.front());
+      queue_.pop_front();
+    }
+    dequeued_.notify_one();
+    writeLpObjective(file_, *lp_, solution);
+    writePrimalSolution(file_, *lp_, solution, sparse_);
+    fflush(file_);
+  }
+}
+
+bool HighsMipSolutionWriter::close() {
+  if (file_ == nullptr) return true;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    finish_ = true;
+  }
+  queued_.notify_one();
+  thread_.join();
+  bool ok = fflush(file_) == 0 && ferror(file_) == 0;
+#ifdef _WIN32
+  ok = _commit(_fileno(file_)) == 0 && ok;
+#else
+  ok = fsync(fileno(file_)) == 0 && ok;
+#endif
+  ok = fclose(file_) == 0 && ok;
+  file_ = nullptr;
+  queue_.clear();
+  free_buffers_.clear();
+  return ok;
+}
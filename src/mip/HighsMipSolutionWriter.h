@@ -0,0 +1,71 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file mip/HighsMipSolutionWriter.h
+ * @brief Writes improving MIP solutions to file in a background thread
+ */
+
+#ifndef HIGHS_MIP_SOLUTION_WRITER_H_
+#define HIGHS_MIP_SOLUTION_WRITER_H_
+
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "lp_data/HighsLp.h"
+
+// Improving solutions are copied into a bounded queue, and written by
+// a thread of their own, so that the MIP solver only waits for a
+// solution to be formatted or written if the queue is full. Every
+// solution is written. The buffers of written solutions are reused, so
+// that copying a solution does not allocate.
+class HighsMipSolutionWriter {
+ public:
+  ~HighsMipSolutionWriter() { close(); }
+
+  // Opens the file and starts the writer thread. Returns false if the
+  // file cannot be opened
+  bool open(const std::string& filename, const HighsLp& lp,
+            const bool sparse);
+
+  bool isOpen() const { return file_ != nullptr; }
+
+  // Queues a copy of the solution to be written, waiting for the
+  // writer thread to take a solution from the queue if it is full
+  void write(const std::vector<double>& solution);
+
+  // Writes any queued solutions, stops the writer thread, and closes
+  // the file once its data are on disk. Returns false if there has
+  // been an error writing the file
+  bool close();
+
+ private:
+  static const size_t kMaxQueued = 4;
+
+  FILE* file_ = nullptr;
+  const HighsLp* lp_ = nullptr;
+  bool sparse_ = false;
+
+  std::thread thread_;
+  std::mutex mutex_;
+  std::condition_variable queued_;
+  std::condition_variable dequeued_;
+  std::deque<std::vector<double>> queue_;
+  std::vector<std::vector<double>> free_buffers_;
+  bool finish_ = false;
+
+  void run();
+};
+
+#endif
@@ -17,6 +17,8 @@
 #include "mip/HighsDomain.h"
 #include "mip/HighsImplications.h"
 #include "mip/HighsLpRelaxation.h"
+#include "mip/HighsMipCheckpoint.h"
+#include "mip/HighsMipSolutionWriter.h"
 #include "mip/HighsMipSolverData.h"
 #include "mip/HighsPseudocost.h"
 #include "mip/HighsSearch.h"
@@ -41,7 +43,9 @@ HighsMipSolver::HighsMipSolver(HighsCallback& callback,
       rootbasis(nullptr),
       pscostinit(nullptr),
       clqtableinit(nullptr),
-      implicinit(nullptr) {
+      implicinit(nullptr),
+      cutpoolinit(nullptr),
+      checkpoint(nullptr) {
   if (solution.value_valid) {
     // MIP solver doesn't check row residuals, but they should be OK
     // so validate using assert
@@ -107,13 +111,24 @@ void HighsMipSolver::run() {
   // Start the solve_clock for the timer that is local to the HighsMipSolver
   // instance
   timer_.start(timer_.solve_clock);
-  improving_solution_file_ = nullptr;
-  if (!submip && options_mip_->mip_improving_solution_file != "")
-    improving_solution_file_ =
-        fopen(options_mip_->mip_improving_solution_file.c_str(), "w");
+  improving_solution_writer_.reset();
+  if (!submip && options_mip_->mip_improving_solution_file != "") {
+    improving_solution_writer_.reset(new HighsMipSolutionWriter());
+    if (!improving_solution_writer_->open(
+            options_mip_->mip_improving_solution_file, *orig_model_,
+            options_mip_->mip_improving_solution_report_sparse)) {
+      highsLogUser(options_mip_->log_options, HighsLogType::kWarning,
+                   "Cannot open improving solution file %s\n",
+                   options_mip_->mip_improving_solution_file.c_str());
+      improving_solution_writer_.reset();
+    }
+  }
 
   mipdata_ = decltype(mipdata_)(new HighsMipSolverData(*this));
   mipdata_->init();
+  // the pseudocosts of a checkpoint are given for the original columns and
+  // are used to initialize the pseudocosts of the presolved model
+  if (checkpoint) pscostinit = &checkpoint->pscost;
   mipdata_->runPresolve(options_mip_->presolve_reduction_limit);
   // Identify whether time limit has been reached (in presolve)
   if (modelstatus_ == HighsModelStatus::kNotset &&
@@ -135,6 +150,10 @@ void HighsMipSolver::run() {
   }
 
   mipdata_->runSetup();
+  if (checkpoint) pscostinit = nullptr;
+  if (cutpoolinit && modelstatus_ == HighsModelStatus::kNotset)
+    mipdata_->transferParentCuts(*cutpoolinit);
+  cutpoolinit = nullptr;
 restart:
   if (modelstatus_ == HighsModelStatus::kNotset) {
     mipdata_->evaluateRootNode();
@@ -145,6 +164,17 @@ restart:
     mipdata_->cutpool.performAging();
     mipdata_->cutpool.performAging();
     mipdata_->cutpool.performAging();
+
+    // when resuming from a checkpoint the root node is replaced by the open
+    // nodes of the checkpoint, which is only done once
+    if (checkpoint && !mipdata_->nodequeue.empty() &&
+        !mipdata_->restoreCheckpointNodes(*checkpoint))
+      modelstatus_ = HighsModelStatus::kSolveError;
+    checkpoint = nullptr;
+  }
+  if (modelstatus_ == HighsModelStatus::kSolveError) {
+    cleanupSolve();
+    return;
   }
   if (mipdata_->nodequeue.empty()) {
     cleanupSolve();
@@ -159,6 +189,10 @@ restart:
   search.setLpRelaxation(&mipdata_->lp);
   sepa.setLpRelaxation(&mipdata_->lp);
 
+  if (!mipdata_->reloadSpilledNodes()) {
+    cleanupSolve();
+    return;
+  }
   mipdata_->lower_bound = mipdata_->nodequeue.getBestLowerBound();
 
   mipdata_->printDisplayLine();
@@ -201,12 +235,16 @@ restart:
             mipdata_->heuristics.randomizedRounding(
                 mipdata_->lp.getLpSolver().getSolution().col_value);
 
-          if (mipdata_->incumbent.empty())
-            mipdata_->heuristics.RENS(
-                mipdata_->lp.getLpSolver().getSolution().col_value);
-          else
+          if (mipdata_->incumbent.empty()) {
+            if (mipdata_->heuristics.heuristicScheduled(
+                    HighsPrimalHeuristics::kHeuristicRens))
+              mipdata_->heuristics.RENS(
+                  mipdata_->lp.getLpSolver().getSolution().col_value);
+          } else if (mipdata_->heuristics.heuristicScheduled(
+                         HighsPrimalHeuristics::kHeuristicRins)) {
             mipdata_->heuristics.RINS(
                 mipdata_->lp.getLpSolver().getSolution().col_value);
+          }
 
           mipdata_->heuristics.flushStatistics();
         }
@@ -254,6 +292,9 @@ restart:
       break;
     }
 
+    // all open nodes are in the node queue now
+    if (mipdata_->checkpointDue()) mipdata_->writeCheckpoint();
+
     // the search datastructure should have no installed node now
     assert(!search.hasNode());
 
@@ -378,6 +419,13 @@ restart:
       // (HighsInt)nodequeue.size());
       assert(!search.hasNode());
 
+      // any spilled nodes that popping a node would read back are read
+      // here, so that the search stops with an error if they are lost
+      if (!mipdata_->reloadSpilledNodes()) {
+        limit_reached = true;
+        break;
+      }
+
       if (numQueueLeaves - lastLbLeave >= 10) {
         search.installNode(mipdata_->nodequeue.popBestBoundNode());
         lastLbLeave = numQueueLeaves;
@@ -493,11 +541,37 @@ restart:
     if (limit_reached) break;
   }
 
+  // write the final checkpoint, whose open nodes are left over when the
+  // search was stopped by a limit or an interrupt. When the search is
+  // complete, so the MIP is optimal or infeasible, there is nothing to
+  // resume
+  const bool search_complete = modelstatus_ == HighsModelStatus::kNotset ||
+                               modelstatus_ == HighsModelStatus::kInfeasible;
+  if (!submip && options_mip_->mip_checkpoint_file != "" &&
+      !search_complete) {
+    search.openNodesToQueue(mipdata_->nodequeue);
+    mipdata_->writeCheckpoint();
+  }
+
   cleanupSolve();
 }
 
 void HighsMipSolver::cleanupSolve() {
   timer_.start(timer_.postsolve_clock);
+  if (improving_solution_writer_) {
+    // Wait for the improving solutions to be written
+    if (!improving_solution_writer_->close())
+      highsLogUser(options_mip_->log_options, HighsLogType::kWarning,
+                   "Error writing improving solution file %s\n",
+                   options_mip_->mip_improving_solution_file.c_str());
+    improving_solution_writer_.reset();
+  }
+  if (mipdata_->nodequeue.numNodesSpilled() > 0)
+    highsLogUser(options_mip_->log_options, HighsLogType::kInfo,
+                 "%" PRId64
+                 " open nodes were moved to a temporary file to respect "
+                 "the node queue memory limit\n",
+                 mipdata_->nodequeue.numNodesSpilled());
   bool havesolution = solution_objective_ != kHighsInf;
   bool feasible;
   if (havesolution)
@@ -523,6 +597,8 @@ void HighsMipSolver::cleanupSolve() {
   total_lp_iterations_ = mipdata_->total_lp_iterations;
   dual_bound_ = std::min(dual_bound_, primal_bound_);
 
+  if (!submip) mipdata_->heuristics.reportStatistics();
+
   // adjust objective sense in case of maximization problem
   if (orig_model_->sense_ == ObjSense::kMaximize) {
     dual_bound_ = -dual_bound_;
@@ -645,6 +721,10 @@ HighsPresolveStatus HighsMipSolver::getPresolveStatus() const {
   return mipdata_->presolve_status;
 }
 
+const HighsPresolveLog& HighsMipSolver::getPresolveLog() const {
+  return mipdata_->presolve_log;
+}
+
 presolve::HighsPostsolveStack HighsMipSolver::getPostsolveStack() const {
   return mipdata_->postSolveStack;
 }
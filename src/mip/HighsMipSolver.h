@@ -18,6 +18,8 @@
 struct HighsMipSolverData;
 class HighsCutPool;
 struct HighsPseudocostInitialization;
+struct HighsMipCheckpoint;
+class HighsMipSolutionWriter;
 class HighsCliqueTable;
 class HighsImplications;
 
@@ -41,7 +43,7 @@ class HighsMipSolver {
   int64_t node_count_;
   int64_t total_lp_iterations_;
 
-  FILE* improving_solution_file_;
+  std::unique_ptr<HighsMipSolutionWriter> improving_solution_writer_;
   std::vector<HighsObjectiveSolution> saved_objective_and_solution_;
 
   bool submip;
@@ -49,6 +51,8 @@ class HighsMipSolver {
   const HighsPseudocostInitialization* pscostinit;
   const HighsCliqueTable* clqtableinit;
   const HighsImplications* implicinit;
+  const HighsCutPool* cutpoolinit;
+  const HighsMipCheckpoint* checkpoint;
 
   std::unique_ptr<HighsMipSolverData> mipdata_;
 
@@ -97,6 +101,7 @@ class HighsMipSolver {
   void runPresolve(const HighsInt presolve_reduction_limit);
   const HighsLp& getPresolvedModel() const;
   HighsPresolveStatus getPresolveStatus() const;
+  const HighsPresolveLog& getPresolveLog() const;
   presolve::HighsPostsolveStack getPostsolveStack() const;
 
   void callbackGetCutPool() const;
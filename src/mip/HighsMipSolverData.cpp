@@ -15,6 +15,8 @@
 // #include "lp_data/HighsLpUtils.h"
 #include "../extern/pdqsort/pdqsort.h"
 #include "lp_data/HighsModelUtils.h"
+#include "mip/HighsMipCheckpoint.h"
+#include "mip/HighsMipSolutionWriter.h"
 #include "mip/HighsPseudocost.h"
 #include "mip/HighsRedcostFixing.h"
 #include "parallel/HighsParallel.h"
@@ -359,8 +361,11 @@ void HighsMipSolverData::init() {
   maxTreeSizeLog2 = 0;
   numRestarts = 0;
   numRestartsRoot = 0;
+  numRestartCutsTransferred = 0;
+  numCheckpointNodesRestored = 0;
   numImprovingSols = 0;
   pruned_treeweight = 0;
+  last_checkpoint_time = 0;
   avgrootlpiters = 0;
   num_nodes = 0;
   num_nodes_before_run = 0;
@@ -406,6 +411,7 @@ void HighsMipSolverData::runPresolve(const HighsInt presolve_reduction_limit) {
   } else {
     mipsolver.modelstatus_ = presolve.run(postSolveStack);
     presolve_status = presolve.getPresolveStatus();
+    presolve_log = presolve.getPresolveLog();
   }
   mipsolver.timer_.stop(mipsolver.timer_.presolve_clock);
 
@@ -476,6 +482,7 @@ void HighsMipSolverData::runSetup() {
   pseudocost = HighsPseudocost(mipsolver);
   nodequeue.setNumCol(mipsolver.numCol());
   nodequeue.setOptimalityLimit(optimality_limit);
+  nodequeue.setMemoryLimit(mipsolver.options_mip_->mip_node_queue_memory_limit);
 
   continuous_cols.clear();
   integer_cols.clear();
@@ -949,6 +956,13 @@ void HighsMipSolverData::performRestart() {
   heuristic_lp_iterations_before_run = heuristic_lp_iterations;
   sepa_lp_iterations_before_run = sepa_lp_iterations;
   sb_lp_iterations_before_run = sb_lp_iterations;
+  // the cuts of the pool that are not in the LP are stored in the space of
+  // the original columns so that the ones that stay valid can be transferred
+  // to the pool after the restart
+  HighsCutSet origCuts;
+  std::vector<uint8_t> origCutIntegral;
+  saveCutsForRestart(origCuts, origCutIntegral);
+
   HighsInt numLpRows = lp.getLp().num_row_;
   HighsInt numModelRows = mipsolver.numRow();
   HighsInt numCuts = numLpRows - numModelRows;
@@ -1039,6 +1053,8 @@ void HighsMipSolverData::performRestart() {
     return;
   }
   runSetup();
+  if (mipsolver.modelstatus_ == HighsModelStatus::kNotset)
+    transferOrigCuts(origCuts, origCutIntegral);
 
   postSolveStack.removeCutsFromModel(numCuts);
 
@@ -1050,6 +1066,162 @@ void HighsMipSolverData::performRestart() {
   mipsolver.pscostinit = nullptr;
 }
 
+void HighsMipSolverData::saveCutsForRestart(
+    HighsCutSet& origCuts, std::vector<uint8_t>& origCutIntegral) {
+  cutpool.getAvailableCuts(origCuts);
+  origCutIntegral.clear();
+  if (origCuts.empty()) return;
+
+  std::vector<double> colScale;
+  std::vector<double> colConstant;
+  postSolveStack.getReducedColTransforms(colScale, colConstant);
+
+  // substitute col = (origCol - constant) / scale and remove globally fixed
+  // columns. Cuts on columns that cannot be expressed in the original space
+  // are dropped
+  HighsInt numCuts = origCuts.numCuts();
+  HighsInt numKeptCuts = 0;
+  HighsInt offset = 0;
+  for (HighsInt i = 0; i != numCuts; ++i) {
+    HighsInt start = origCuts.ARstart_[i];
+    HighsInt end = origCuts.ARstart_[i + 1];
+    HighsCDouble rhs = origCuts.upper_[i];
+    bool integral = cutpool.cutIsIntegral(origCuts.cutindices[i]);
+    bool valid = true;
+    HighsInt cutStart = offset;
+    for (HighsInt j = start; j != end; ++j) {
+      HighsInt col = origCuts.ARindex_[j];
+      double val = origCuts.ARvalue_[j];
+      if (domain.isFixed(col)) {
+        rhs -= val * domain.col_lower_[col];
+        continue;
+      }
+      if (colScale[col] == 0.0) {
+        valid = false;
+        break;
+      }
+      if (std::abs(colScale[col]) != 1.0 ||
+          colConstant[col] != std::floor(colConstant[col]))
+        integral = false;
+      val /= colScale[col];
+      rhs += val * colConstant[col];
+      origCuts.ARindex_[offset] = postSolveStack.getOrigColIndex(col);
+      origCuts.ARvalue_[offset] = val;
+      ++offset;
+    }
+
+    if (!valid || offset == cutStart) {
+      offset = cutStart;
+      continue;
+    }
+
+    origCuts.ARstart_[numKeptCuts] = cutStart;
+    origCuts.upper_[numKeptCuts] = double(rhs);
+    origCutIntegral.push_back(integral);
+    ++numKeptCuts;
+  }
+
+  origCuts.cutindices.resize(numKeptCuts);
+  origCuts.resize(offset);
+  origCuts.ARstart_[numKeptCuts] = offset;
+}
+
+void HighsMipSolverData::transferOrigCuts(
+    HighsCutSet& origCuts, const std::vector<uint8_t>& origCutIntegral) {
+  if (origCuts.empty()) return;
+
+  std::vector<double> colScale;
+  std::vector<double> colConstant;
+  postSolveStack.getReducedColTransforms(colScale, colConstant);
+
+  std::vector<HighsInt> reducedColIndex(postSolveStack.getOrigNumCol(), -1);
+  for (HighsInt i = 0; i != mipsolver.numCol(); ++i)
+    reducedColIndex[postSolveStack.getOrigColIndex(i)] = i;
+
+  // substitute origCol = scale * col + constant. Cuts containing columns that
+  // were removed by presolve after the restart are dropped
+  HighsInt numCuts = origCuts.numCuts();
+  HighsInt numTransferred = 0;
+  for (HighsInt i = 0; i != numCuts; ++i) {
+    HighsInt start = origCuts.ARstart_[i];
+    HighsInt end = origCuts.ARstart_[i + 1];
+    HighsCDouble rhs = origCuts.upper_[i];
+    bool integral = origCutIntegral[i];
+    bool valid = true;
+    for (HighsInt j = start; j != end; ++j) {
+      HighsInt col = reducedColIndex[origCuts.ARindex_[j]];
+      if (col == -1 || colScale[col] == 0.0) {
+        valid = false;
+        break;
+      }
+      if (std::abs(colScale[col]) != 1.0 ||
+          colConstant[col] != std::floor(colConstant[col]))
+        integral = false;
+      rhs -= origCuts.ARvalue_[j] * colConstant[col];
+      origCuts.ARvalue_[j] *= colScale[col];
+      origCuts.ARindex_[j] = col;
+    }
+
+    if (!valid) continue;
+
+    HighsInt cut = cutpool.addCut(mipsolver, &origCuts.ARindex_[start],
+                                  &origCuts.ARvalue_[start], end - start,
+                                  double(rhs), integral);
+    if (cut != -1) ++numTransferred;
+  }
+  numRestartCutsTransferred += numTransferred;
+
+  highsLogDev(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
+              "Transferred %" HIGHSINT_FORMAT " of %" HIGHSINT_FORMAT
+              " cuts to the presolved model\n",
+              numTransferred, numCuts);
+}
+
+void HighsMipSolverData::transferParentCuts(const HighsCutPool& parentpool) {
+  // the columns of the parent's presolved model are the columns of the
+  // original model of a sub-MIP, so the parent's cuts are valid for it once
+  // the columns fixed in the sub-MIP are substituted
+  HighsCutSet origCuts;
+  parentpool.getAvailableCuts(origCuts);
+  if (origCuts.empty()) return;
+
+  const HighsLp& origModel = *mipsolver.orig_model_;
+  std::vector<uint8_t> origCutIntegral;
+  HighsInt numCuts = origCuts.numCuts();
+  HighsInt numKeptCuts = 0;
+  HighsInt offset = 0;
+  for (HighsInt i = 0; i != numCuts; ++i) {
+    HighsInt start = origCuts.ARstart_[i];
+    HighsInt end = origCuts.ARstart_[i + 1];
+    HighsCDouble rhs = origCuts.upper_[i];
+    HighsInt cutStart = offset;
+    for (HighsInt j = start; j != end; ++j) {
+      HighsInt col = origCuts.ARindex_[j];
+      double val = origCuts.ARvalue_[j];
+      if (origModel.col_lower_[col] == origModel.col_upper_[col]) {
+        rhs -= val * origModel.col_lower_[col];
+        continue;
+      }
+      origCuts.ARindex_[offset] = col;
+      origCuts.ARvalue_[offset] = val;
+      ++offset;
+    }
+
+    if (offset == cutStart) continue;
+
+    origCuts.ARstart_[numKeptCuts] = cutStart;
+    origCuts.upper_[numKeptCuts] = double(rhs);
+    origCutIntegral.push_back(
+        parentpool.cutIsIntegral(origCuts.cutindices[i]));
+    ++numKeptCuts;
+  }
+
+  origCuts.cutindices.resize(numKeptCuts);
+  origCuts.resize(offset);
+  origCuts.ARstart_[numKeptCuts] = offset;
+  transferOrigCuts(origCuts, origCutIntegral);
+}
+
 void HighsMipSolverData::basisTransfer() {
   // if a root basis is given, construct a basis for the root LP from
   // in the reduced problem space after presolving
@@ -1792,6 +1964,16 @@ restart:
   }
 }
 
+bool HighsMipSolverData::reloadSpilledNodes() {
+  if (nodequeue.reloadSpilledNodes()) return true;
+  // open nodes that cannot be read back from the temporary file are lost,
+  // so the search cannot be completed
+  highsLogUser(mipsolver.options_mip_->log_options, HighsLogType::kError,
+               "Unable to read open nodes from the temporary file\n");
+  mipsolver.modelstatus_ = HighsModelStatus::kSolveError;
+  return false;
+}
+
 bool HighsMipSolverData::checkLimits(int64_t nodeOffset) const {
   const HighsOptions& options = *mipsolver.options_mip_;
 
@@ -1939,13 +2121,89 @@ void HighsMipSolverData::saveReportMipSolution(const double new_upper_limit) {
     record.col_value = mipsolver.solution_;
     mipsolver.saved_objective_and_solution_.push_back(record);
   }
-  FILE* file = mipsolver.improving_solution_file_;
-  if (file) {
-    writeLpObjective(file, *(mipsolver.orig_model_), mipsolver.solution_);
-    writePrimalSolution(
-        file, *(mipsolver.orig_model_), mipsolver.solution_,
-        mipsolver.options_mip_->mip_improving_solution_report_sparse);
+  // The solution is written to file in the background
+  if (mipsolver.improving_solution_writer_)
+    mipsolver.improving_solution_writer_->write(mipsolver.solution_);
+}
+
+bool HighsMipSolverData::checkpointDue() const {
+  if (mipsolver.submip || mipsolver.options_mip_->mip_checkpoint_file == "")
+    return false;
+
+  return mipsolver.timer_.read(mipsolver.timer_.solve_clock) -
+             last_checkpoint_time >=
+         mipsolver.options_mip_->mip_checkpoint_interval;
+}
+
+void HighsMipSolverData::writeCheckpoint() {
+  last_checkpoint_time = mipsolver.timer_.read(mipsolver.timer_.solve_clock);
+
+  HighsMipCheckpoint checkpoint;
+  checkpoint.origNumCol = mipsolver.orig_model_->num_col_;
+  if (mipsolver.solution_objective_ != kHighsInf) {
+    checkpoint.incumbentObjective = mipsolver.solution_objective_;
+    checkpoint.incumbent = mipsolver.solution_;
+  }
+  checkpoint.pscost =
+      HighsPseudocostInitialization(pseudocost, kHighsIInf, postSolveStack);
+
+  checkpoint.numCol = mipsolver.numCol();
+  checkpoint.numRow = mipsolver.numRow();
+  checkpoint.modelHash = HighsMipCheckpoint::computeModelHash(*mipsolver.model_);
+  checkpoint.prunedTreeweight = double(pruned_treeweight);
+  nodequeue.forEachNode([&](const HighsNodeQueue::OpenNode& node) {
+    checkpoint.nodes.push_back({node.domchgstack, node.branchings,
+                                node.lower_bound, node.estimate, node.depth});
+  });
+
+  const std::string& filename = mipsolver.options_mip_->mip_checkpoint_file;
+  if (checkpoint.write(filename))
+    highsLogDev(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
+                "Written MIP checkpoint with %" HIGHSINT_FORMAT
+                " open nodes to %s\n",
+                (HighsInt)checkpoint.nodes.size(), filename.c_str());
+  else
+    highsLogUser(mipsolver.options_mip_->log_options, HighsLogType::kWarning,
+                 "Unable to write MIP checkpoint to %s\n", filename.c_str());
+}
+
+bool HighsMipSolverData::restoreCheckpointNodes(
+    const HighsMipCheckpoint& checkpoint) {
+  // the open nodes are only valid for the presolved model they were created
+  // for, which is not reproduced when the checkpoint was written after a
+  // restart
+  if (!checkpoint.matchesModel(*mipsolver.model_)) {
+    highsLogUser(mipsolver.options_mip_->log_options, HighsLogType::kError,
+                 "Open nodes of the MIP checkpoint do not match the presolved "
+                 "model\n");
+    return false;
+  }
+
+  nodequeue.clear();
+  nodequeue.setOptimalityLimit(optimality_limit);
+  for (const HighsMipCheckpoint::Node& node : checkpoint.nodes) {
+    if (node.lower_bound > upper_limit) continue;
+    std::vector<HighsDomainChange> domchgstack = node.domchgstack;
+    std::vector<HighsInt> branchings = node.branchings;
+    // suboptimal nodes are written with an infinite estimate, and the node
+    // queue determines again whether they are suboptimal. Their tree weight
+    // is already part of the pruned tree weight of the checkpoint
+    const double estimate =
+        node.estimate == kHighsInf ? node.lower_bound : node.estimate;
+    nodequeue.emplaceNode(std::move(domchgstack), std::move(branchings),
+                          std::max(node.lower_bound, lower_bound), estimate,
+                          node.depth);
   }
+  numCheckpointNodesRestored = nodequeue.numNodes();
+  pruned_treeweight = checkpoint.prunedTreeweight;
+  pruned_treeweight += nodequeue.pruneInfeasibleNodes(domain, feastol);
+  lower_bound = std::min(upper_bound, nodequeue.getBestLowerBound());
+
+  highsLogUser(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
+               "Resuming the search from %" HIGHSINT_FORMAT
+               " open nodes of the MIP checkpoint\n",
+               (HighsInt)nodequeue.numActiveNodes());
+  return true;
 }
 
 void HighsMipSolverData::limitsToBounds(double& dual_bound,
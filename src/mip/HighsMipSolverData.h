@@ -47,6 +47,7 @@ struct HighsMipSolverData {
   HighsObjectiveFunction objectiveFunction;
   presolve::HighsPostsolveStack postSolveStack;
   HighsPresolveStatus presolve_status;
+  HighsPresolveLog presolve_log;
   HighsLp presolvedModel;
   bool cliquesExtracted;
   bool rowMatrixSet;
@@ -55,6 +56,8 @@ struct HighsMipSolverData {
   bool detectSymmetries;
   HighsInt numRestarts;
   HighsInt numRestartsRoot;
+  HighsInt numRestartCutsTransferred;
+  int64_t numCheckpointNodesRestored;
   HighsInt numCliqueEntriesAfterPresolve;
   HighsInt numCliqueEntriesAfterFirstPresolve;
 
@@ -89,6 +92,7 @@ struct HighsMipSolverData {
   HighsCDouble pruned_treeweight;
   double avgrootlpiters;
   double last_disptime;
+  double last_checkpoint_time;
   int64_t firstrootlpiters;
   int64_t num_nodes;
   int64_t num_leaves;
@@ -165,6 +169,11 @@ struct HighsMipSolverData {
       const bool possibly_store_as_new_incumbent = true);
   double percentageInactiveIntegers() const;
   void performRestart();
+  void saveCutsForRestart(HighsCutSet& origCuts,
+                          std::vector<uint8_t>& origCutIntegral);
+  void transferOrigCuts(HighsCutSet& origCuts,
+                        const std::vector<uint8_t>& origCutIntegral);
+  void transferParentCuts(const HighsCutPool& parentpool);
   bool checkSolution(const std::vector<double>& solution) const;
   bool trySolution(const std::vector<double>& solution, char source = ' ');
   bool rootSeparationRound(HighsSeparation& sepa, HighsInt& ncuts,
@@ -172,6 +181,9 @@ struct HighsMipSolverData {
   HighsLpRelaxation::Status evaluateRootLp();
   void evaluateRootNode();
   bool addIncumbent(const std::vector<double>& sol, double solobj, char source);
+  bool checkpointDue() const;
+  void writeCheckpoint();
+  bool restoreCheckpointNodes(const HighsMipCheckpoint& checkpoint);
 
   const std::vector<double>& getSolution() const;
 
@@ -186,6 +198,7 @@ struct HighsMipSolverData {
   }
 
   bool checkLimits(int64_t nodeOffset = 0) const;
+  bool reloadSpilledNodes();
   void limitsToBounds(double& dual_bound, double& primal_bound,
                       double& mip_rel_gap) const;
   bool interruptFromCallbackWithData(const int callback_type,
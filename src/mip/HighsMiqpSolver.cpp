@@ -0,0 +1,250 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file mip/HighsMiqpSolver.cpp
+ * @brief Branch-and-bound for convex MIQPs over QP relaxations
+ */
+#include "mip/HighsMiqpSolver.h"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdio>
+
+HighsMiqpSolver::HighsMiqpSolver(const HighsOptions& options,
+                                 const HighsModel& model, HighsTimer& timer)
+    : modelstatus_(HighsModelStatus::kNotset),
+      solution_objective_(kHighsInf),
+      integrality_violation_(0),
+      dual_bound_(-kHighsInf),
+      gap_(kHighsInf),
+      node_count_(0),
+      total_qp_iterations_(0),
+      options_(options),
+      model_(model),
+      timer_(timer) {}
+
+double HighsMiqpSolver::upperLimit(double primal_bound) const {
+  if (primal_bound == kHighsInf) return kHighsInf;
+  return primal_bound - std::max(options_.mip_abs_gap,
+                                 options_.mip_rel_gap * fabs(primal_bound));
+}
+
+HighsInt HighsMiqpSolver::selectBranchingColumn(
+    const std::vector<double>& col_value, double& max_fractionality) const {
+  const HighsLp& lp = model_.lp_;
+  HighsInt branch_col = -1;
+  max_fractionality = 0;
+  for (HighsInt iCol = 0; iCol < lp.num_col_; iCol++) {
+    if (lp.integrality_[iCol] != HighsVarType::kInteger) continue;
+    const double fractionality =
+        fabs(col_value[iCol] - std::floor(col_value[iCol] + 0.5));
+    if (fractionality > max_fractionality) {
+      max_fractionality = fractionality;
+      branch_col = iCol;
+    }
+  }
+  if (max_fractionality <= options_.mip_feasibility_tolerance) return -1;
+  return branch_col;
+}
+
+void HighsMiqpSolver::logProgress(int64_t num_open, double dual_bound,
+                                  double primal_bound,
+                                  bool new_incumbent) const {
+  const double sense = (double)model_.lp_.sense_;
+  std::array<char, 16> gap_string = {"inf"};
+  if (primal_bound != kHighsInf && primal_bound != 0.0) {
+    const double gap = (primal_bound - dual_bound) / fabs(primal_bound);
+    std::snprintf(gap_string.data(), gap_string.size(), "%.2f%%",
+                  100.0 * gap);
+  }
+  highsLogUser(options_.log_options, HighsLogType::kInfo,
+               " %s %10d %10d %14.8g %14.8g %9s %9.1fs\n",
+               new_incumbent ? "T" : " ", (int)node_count_, (int)num_open,
+               sense * dual_bound,
+               primal_bound == kHighsInf ? sense * kHighsInf
+                                         : sense * primal_bound,
+               gap_string.data(), timer_.readRunHighsClock());
+}
+
+void HighsMiqpSolver::run() {
+  const HighsLp& lp = model_.lp_;
+  const HighsInt num_col = lp.num_col_;
+  // Objective values are compared in the sense of minimization
+  const double sense = (double)lp.sense_;
+
+  Highs relaxation;
+  relaxation.passOptions(options_);
+  relaxation.setOptionValue("output_flag", false);
+  // Only the active set QP solver can be hot started
+  relaxation.setOptionValue("solver", kHighsChooseString);
+  HighsModel relaxed_model = model_;
+  relaxed_model.lp_.integrality_.clear();
+  relaxation.passModel(std::move(relaxed_model));
+  const HighsInfo& relaxation_info = relaxation.getInfo();
+
+  highsLogUser(options_.log_options, HighsLogType::kInfo,
+               "Solving MIQP by branch-and-bound on its QP relaxations\n\n"
+               "          Nodes       Open     Dual bound   Primal bound"
+               "       Gap      Time\n");
+
+  // Open nodes are held in a heap with the best lower bound on top,
+  // ties being broken in favour of the deeper node, so that the
+  // search dives until the first incumbent is found
+  auto worseNode = [](const Node& a, const Node& b) {
+    if (a.lower_bound != b.lower_bound) return a.lower_bound > b.lower_bound;
+    return a.depth < b.depth;
+  };
+  std::vector<Node> open_nodes(1);
+  open_nodes[0].lower_bound = -kHighsInf;
+  open_nodes[0].depth = 0;
+
+  double primal_bound = kHighsInf;
+  std::vector<double> col_lower;
+  std::vector<double> col_upper;
+  HighsSolution start_solution;
+  const int64_t kLogFrequency = 100;
+  modelstatus_ = HighsModelStatus::kNotset;
+  while (!open_nodes.empty()) {
+    const double time_left = options_.time_limit - timer_.readRunHighsClock();
+    if (time_left <= 0) {
+      modelstatus_ = HighsModelStatus::kTimeLimit;
+      break;
+    }
+    if (node_count_ >= options_.mip_max_nodes) {
+      modelstatus_ = HighsModelStatus::kSolutionLimit;
+      break;
+    }
+    std::pop_heap(open_nodes.begin(), open_nodes.end(), worseNode);
+    Node node = std::move(open_nodes.back());
+    open_nodes.pop_back();
+    if (node.lower_bound >= upperLimit(primal_bound)) continue;
+
+    col_lower = lp.col_lower_;
+    col_upper = lp.col_upper_;
+    for (size_t k = 0; k < node.branch_col.size(); k++) {
+      col_lower[node.branch_col[k]] = node.branch_lower[k];
+      col_upper[node.branch_col[k]] = node.branch_upper[k];
+    }
+    relaxation.changeColsBounds(0, num_col - 1, col_lower.data(),
+                                col_upper.data());
+    if (node.warm_start) {
+      // The parent's solution is only a feasible starting point if the
+      // branching column is moved onto its new bound, and this may
+      // violate rows containing it, in which case QUASS starts from
+      // scratch. Setting the solution computes the row values. The
+      // basis must be set after the solution, since setting the
+      // solution invalidates the basis
+      const HighsInt col = node.branch_col.back();
+      start_solution.col_value = node.warm_start->col_value;
+      start_solution.col_value[col] =
+          std::min(std::max(start_solution.col_value[col], col_lower[col]),
+                   col_upper[col]);
+      relaxation.setSolution(start_solution);
+      relaxation.setBasis(node.warm_start->basis);
+    }
+    relaxation.setOptionValue("time_limit", time_left);
+    relaxation.run();
+    node_count_++;
+    total_qp_iterations_ += relaxation_info.qp_iteration_count;
+
+    const HighsModelStatus relaxation_status = relaxation.getModelStatus();
+    if (relaxation_status == HighsModelStatus::kInfeasible) continue;
+    if (relaxation_status != HighsModelStatus::kOptimal) {
+      if (relaxation_status == HighsModelStatus::kTimeLimit) {
+        modelstatus_ = HighsModelStatus::kTimeLimit;
+      } else if (relaxation_status == HighsModelStatus::kUnbounded ||
+                 relaxation_status ==
+                     HighsModelStatus::kUnboundedOrInfeasible) {
+        // An unbounded convex QP relaxation means that the MIQP is
+        // unbounded if it has an integer feasible point
+        modelstatus_ = HighsModelStatus::kUnboundedOrInfeasible;
+      } else {
+        highsLogUser(options_.log_options, HighsLogType::kError,
+                     "QP relaxation at node %d has status %s\n",
+                     (int)node_count_,
+                     relaxation.modelStatusToString(relaxation_status).c_str());
+        modelstatus_ = HighsModelStatus::kSolveError;
+      }
+      // Return the node to the queue so that the dual bound accounts
+      // for it
+      open_nodes.push_back(std::move(node));
+      std::push_heap(open_nodes.begin(), open_nodes.end(), worseNode);
+      break;
+    }
+    const double objective = sense * relaxation_info.objective_function_value;
+    if (objective >= upperLimit(primal_bound)) continue;
+
+    const std::vector<double>& col_value = relaxation.getSolution().col_value;
+    double max_fractionality;
+    const HighsInt branch_col =
+        selectBranchingColumn(col_value, max_fractionality);
+    if (branch_col < 0) {
+      // New incumbent
+      primal_bound = objective;
+      solution_objective_ = relaxation_info.objective_function_value;
+      solution_ = col_value;
+      integrality_violation_ = max_fractionality;
+      const double dual_bound =
+          open_nodes.empty()
+              ? primal_bound
+              : std::min(primal_bound, open_nodes.front().lower_bound);
+      logProgress(open_nodes.size(), dual_bound, primal_bound, true);
+      continue;
+    }
+
+    // Branch on the most fractional integer variable
+    const double value = col_value[branch_col];
+    std::shared_ptr<WarmStart> warm_start = std::make_shared<WarmStart>();
+    warm_start->basis = relaxation.getBasis();
+    warm_start->col_value = col_value;
+    for (HighsInt direction = 0; direction < 2; direction++) {
+      Node child;
+      child.branch_col = node.branch_col;
+      child.branch_lower = node.branch_lower;
+      child.branch_upper = node.branch_upper;
+      child.branch_col.push_back(branch_col);
+      if (direction == 0) {
+        child.branch_lower.push_back(col_lower[branch_col]);
+        child.branch_upper.push_back(std::floor(value));
+      } else {
+        child.branch_lower.push_back(std::ceil(value));
+        child.branch_upper.push_back(col_upper[branch_col]);
+      }
+      child.lower_bound = objective;
+      child.depth = node.depth + 1;
+      child.warm_start = warm_start;
+      open_nodes.push_back(std::move(child));
+      std::push_heap(open_nodes.begin(), open_nodes.end(), worseNode);
+    }
+    if (node_count_ % kLogFrequency == 0)
+      logProgress(open_nodes.size(), open_nodes.front().lower_bound,
+                  primal_bound, false);
+  }
+
+  // Nodes left open that cannot improve on the incumbent do not count
+  // towards the dual bound
+  double dual_bound = primal_bound;
+  for (const Node& node : open_nodes)
+    if (node.lower_bound < upperLimit(primal_bound))
+      dual_bound = std::min(node.lower_bound, dual_bound);
+  if (modelstatus_ == HighsModelStatus::kNotset)
+    modelstatus_ = primal_bound == kHighsInf ? HighsModelStatus::kInfeasible
+                                             : HighsModelStatus::kOptimal;
+  logProgress(open_nodes.size(), dual_bound, primal_bound, false);
+
+  dual_bound_ = sense * dual_bound;
+  if (primal_bound == kHighsInf)
+    gap_ = kHighsInf;
+  else if (primal_bound == 0.0)
+    gap_ = dual_bound == 0.0 ? 0.0 : kHighsInf;
+  else
+    gap_ = fabs(primal_bound - dual_bound) / fabs(primal_bound);
+}
@@ -0,0 +1,82 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file mip/HighsMiqpSolver.h
+ * @brief Branch-and-bound for convex MIQPs over QP relaxations
+ */
+#ifndef MIP_HIGHS_MIQP_SOLVER_H_
+#define MIP_HIGHS_MIQP_SOLVER_H_
+
+#include <memory>
+
+#include "Highs.h"
+
+// Solves a convex MIQP by best-first branch-and-bound on the most
+// fractional integer variable. The QP relaxation at each node is solved
+// by the active set QP solver, hot started from the basis and solution
+// of the parent node when that solution, with the branching column
+// moved onto its new bound, is feasible. There is no presolve,
+// propagation or cutting, so it is only suitable for small to
+// medium-sized MIQPs.
+class HighsMiqpSolver {
+ public:
+  HighsMiqpSolver(const HighsOptions& options, const HighsModel& model,
+                  HighsTimer& timer);
+
+  void run();
+
+  // The following are only to return data to HiGHS
+  HighsModelStatus modelstatus_;
+  std::vector<double> solution_;
+  double solution_objective_;
+  double integrality_violation_;
+  double dual_bound_;
+  double gap_;
+  int64_t node_count_;
+  int64_t total_qp_iterations_;
+
+ private:
+  // The basis and column values of a node's QP relaxation, from which
+  // QUASS is hot started at each of its children
+  struct WarmStart {
+    HighsBasis basis;
+    std::vector<double> col_value;
+  };
+
+  struct Node {
+    // The branching bound changes on the path from the root, in order
+    std::vector<HighsInt> branch_col;
+    std::vector<double> branch_lower;
+    std::vector<double> branch_upper;
+    // The objective of the parent's QP relaxation, in the sense of
+    // minimization
+    double lower_bound;
+    HighsInt depth;
+    // The parent's warm start, shared with its sibling and null at the
+    // root
+    std::shared_ptr<const WarmStart> warm_start;
+  };
+
+  const HighsOptions& options_;
+  const HighsModel& model_;
+  HighsTimer& timer_;
+
+  // The bound on the minimization objective below which a node must
+  // lie to be worth solving, given the incumbent and the gap tolerances
+  double upperLimit(double primal_bound) const;
+
+  HighsInt selectBranchingColumn(const std::vector<double>& col_value,
+                                 double& max_fractionality) const;
+
+  void logProgress(int64_t num_open, double dual_bound, double primal_bound,
+                   bool new_incumbent) const;
+};
+
+#endif
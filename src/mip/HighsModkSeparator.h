@@ -56,6 +56,8 @@ class HighsModkSeparator : public HighsSeparator {
                           HighsTransformedLp& transLp,
                           HighsCutPool& cutpool) override;
 
+  bool isThreadSafe() const override { return true; }
+
   HighsModkSeparator(const HighsMipSolver& mipsolver)
       : HighsSeparator(mipsolver, "Mod-k sepa", "Mod") {}
 };
@@ -156,6 +156,8 @@ void HighsNodeQueue::link_domchgs(int64_t node) {
   assert(node != -1);
   HighsInt numchgs = nodes[node].domchgstack.size();
   nodes[node].domchglinks.resize(numchgs);
+  numStoredDomchgs += numchgs;
+  numStoredBranchings += nodes[node].branchings.size();
 
   for (HighsInt i = 0; i != numchgs; ++i) {
     double val = nodes[node].domchgstack[i].boundval;
@@ -189,6 +191,8 @@ void HighsNodeQueue::unlink_domchgs(int64_t node) {
 
   nodes[node].domchglinks.clear();
   nodes[node].domchglinks.shrink_to_fit();
+  numStoredDomchgs -= numchgs;
+  numStoredBranchings -= nodes[node].branchings.size();
 }
 
 double HighsNodeQueue::link(int64_t node) {
@@ -220,6 +224,8 @@ void HighsNodeQueue::unlink(int64_t node) {
 void HighsNodeQueue::setNumCol(HighsInt numCol) {
   if (this->numCol == numCol) return;
   this->numCol = numCol;
+  spilledColLowerCount.assign(numCol, 0);
+  spilledColUpperCount.assign(numCol, 0);
   allocatorState = std::unique_ptr<AllocatorState>(new AllocatorState());
 
   if (numCol == 0) return;
@@ -278,15 +284,23 @@ double HighsNodeQueue::pruneInfeasibleNodes(HighsDomain& globaldomain,
                         globaldomain.col_upper_[i], feastol, treeweight);
     }
 
-    size_t numopennodes = numNodes();
+    treeweight += pruneInfeasibleSpilledNodes(globaldomain, feastol);
+
+    int64_t numopennodes = numNodes();
     if (numopennodes == 0) break;
 
     auto colLowerNodes = colLowerNodesPtr.get();
     auto colUpperNodes = colUpperNodesPtr.get();
 
     for (HighsInt i = 0; i < numCol; ++i) {
-      if (colLowerNodes[i].size() == numopennodes) {
-        double globallb = colLowerNodes[i].begin()->first;
+      if (numNodesUp(i) == numopennodes) {
+        double globallb = colLowerNodes[i].empty()
+                              ? kHighsInf
+                              : colLowerNodes[i].begin()->first;
+        for (const SpilledBatch& batch : spilledBatches)
+          for (const SpilledColumnBounds& bounds : batch.columnBounds)
+            if (bounds.column == i && bounds.numLower != 0)
+              globallb = std::min(bounds.minLower, globallb);
         if (globallb > globaldomain.col_lower_[i]) {
           globaldomain.changeBound(HighsBoundType::kLower, i, globallb,
                                    HighsDomain::Reason::unspecified());
@@ -294,8 +308,14 @@ double HighsNodeQueue::pruneInfeasibleNodes(HighsDomain& globaldomain,
         }
       }
 
-      if (colUpperNodes[i].size() == numopennodes) {
-        double globalub = colUpperNodes[i].rbegin()->first;
+      if (numNodesDown(i) == numopennodes) {
+        double globalub = colUpperNodes[i].empty()
+                              ? -kHighsInf
+                              : colUpperNodes[i].rbegin()->first;
+        for (const SpilledBatch& batch : spilledBatches)
+          for (const SpilledColumnBounds& bounds : batch.columnBounds)
+            if (bounds.column == i && bounds.numUpper != 0)
+              globalub = std::max(bounds.maxUpper, globalub);
         if (globalub < globaldomain.col_upper_[i]) {
           globaldomain.changeBound(HighsBoundType::kUpper, i, globalub,
                                    HighsDomain::Reason::unspecified());
@@ -319,11 +339,30 @@ double HighsNodeQueue::pruneNode(int64_t nodeId) {
 }
 
 double HighsNodeQueue::performBounding(double upper_limit) {
-  NodeLowerRbTree lowerTree(this);
+  HighsCDouble treeweight = spilledPrunedTreeweight;
+  spilledPrunedTreeweight = 0.0;
+
+  // spilled batches are pruned as a whole when their best lower bound
+  // exceeds the limits, otherwise their nodes are bounded after reloading
+  for (size_t i = 0; i < spilledBatches.size();) {
+    SpilledBatch& batch = spilledBatches[i];
+    if (batch.minLowerBound >= upper_limit) {
+      if (!batch.suboptimal) treeweight += batch.treeweight;
+      removeSpilledBatch(i);
+      continue;
+    }
 
-  if (lowerTree.empty()) return 0.0;
+    if (!batch.suboptimal && batch.minLowerBound > optimality_limit) {
+      treeweight += batch.treeweight;
+      numSpilledActive -= batch.numNodes;
+      batch.suboptimal = true;
+    }
+    ++i;
+  }
 
-  HighsCDouble treeweight = 0.0;
+  NodeLowerRbTree lowerTree(this);
+
+  if (lowerTree.empty()) return double(treeweight);
 
   int64_t maxLbNode = lowerTree.last();
   while (maxLbNode != -1) {
@@ -384,10 +423,346 @@ double HighsNodeQueue::emplaceNode(std::vector<HighsDomainChange>&& domchgs,
   assert(nodes[pos].estimate == estimate);
   assert(nodes[pos].depth == depth);
 
+  double treeweight = link(pos);
+  if (estimatedMemory() > memoryLimit) spillNodes();
+
+  return treeweight;
+}
+
+std::vector<uint8_t> HighsNodeQueue::getFreeSlotMask() const {
+  std::vector<uint8_t> isFree(nodes.size());
+  auto slots = freeslots;
+  while (!slots.empty()) {
+    isFree[slots.top()] = true;
+    slots.pop();
+  }
+
+  return isFree;
+}
+
+double HighsNodeQueue::domchgMemory() {
+  // each domain change is stored in the stack of its node and as an element
+  // of the node set of its column, which is referenced from the node
+  return sizeof(HighsDomainChange) + sizeof(NodeSet::iterator) +
+         sizeof(NodeSet::value_type) + 4 * sizeof(void*);
+}
+
+double HighsNodeQueue::nodeMemory(const OpenNode& node) {
+  return sizeof(OpenNode) + double(node.domchgstack.size()) * domchgMemory() +
+         double(node.branchings.size()) * sizeof(HighsInt);
+}
+
+double HighsNodeQueue::estimatedMemory() const {
+  // the sum of nodeMemory() over the nodes in memory
+  return double(nodes.size() - freeslots.size()) * sizeof(OpenNode) +
+         double(numStoredDomchgs) * domchgMemory() +
+         double(numStoredBranchings) * sizeof(HighsInt);
+}
+
+double HighsNodeQueue::insertNode(OpenNode&& node) {
+  int64_t pos;
+  if (freeslots.empty()) {
+    pos = nodes.size();
+    nodes.push_back(std::move(node));
+  } else {
+    pos = freeslots.top();
+    freeslots.pop();
+    nodes[pos] = std::move(node);
+  }
+
+  if (nodes[pos].estimate == kHighsInf) {
+    link_suboptimal(pos);
+    link_domchgs(pos);
+    return 0.0;
+  }
+
   return link(pos);
 }
 
+void HighsNodeQueue::spillNodes() {
+  if (!spillFile) {
+    spillFile.reset(std::tmpfile());
+    // without a temporary file all nodes are kept in memory
+    if (!spillFile) {
+      memoryLimit = kHighsInf;
+      return;
+    }
+  }
+
+  std::vector<uint8_t> isFree = getFreeSlotMask();
+  std::vector<int64_t> candidates;
+  candidates.reserve(nodes.size() - freeslots.size());
+  for (size_t i = 0; i < nodes.size(); ++i)
+    if (!isFree[i]) candidates.push_back(i);
+
+  std::sort(candidates.begin(), candidates.end(),
+            [&](int64_t a, int64_t b) {
+              return std::make_pair(nodes[a].lower_bound, a) >
+                     std::make_pair(nodes[b].lower_bound, b);
+            });
+
+  // spill the worst nodes until three quarters of the limit are reached,
+  // but keep at least half of the nodes in memory
+  const double targetMemory = 0.75 * memoryLimit;
+  const size_t maxSpill = candidates.size() / 2;
+  double memory = estimatedMemory();
+  std::vector<const OpenNode*> spillActive;
+  std::vector<const OpenNode*> spillSuboptimal;
+  size_t numSpill = 0;
+  for (; numSpill < maxSpill && memory > targetMemory; ++numSpill) {
+    const OpenNode& node = nodes[candidates[numSpill]];
+    memory -= nodeMemory(node);
+    if (node.estimate == kHighsInf)
+      spillSuboptimal.push_back(&node);
+    else
+      spillActive.push_back(&node);
+  }
+
+  const size_t numBatches = spilledBatches.size();
+  if (!writeSpilledBatch(spillActive, false) ||
+      !writeSpilledBatch(spillSuboptimal, true)) {
+    // all nodes stay in memory, so a batch written before the failure is
+    // discarded
+    while (spilledBatches.size() > numBatches)
+      removeSpilledBatch(spilledBatches.size() - 1);
+    memoryLimit = kHighsInf;
+    return;
+  }
+
+  // the nodes are only removed once their batches are safely written
+  for (size_t i = 0; i < numSpill; ++i) {
+    int64_t node = candidates[i];
+    unlink(node);
+    nodes[node].domchgstack = std::vector<HighsDomainChange>();
+    nodes[node].branchings = std::vector<HighsInt>();
+  }
+  numSpilledTotal += numSpill;
+}
+
+bool HighsNodeQueue::writeSpilledBatch(
+    const std::vector<const OpenNode*>& batchNodes, bool suboptimal) {
+  if (batchNodes.empty()) return true;
+
+  FILE* file = spillFile.get();
+  SpilledBatch batch;
+  if (fseek(file, 0, SEEK_END) != 0 || fgetpos(file, &batch.offset) != 0)
+    return false;
+
+  batch.numNodes = batchNodes.size();
+  batch.minLowerBound = kHighsInf;
+  batch.minLowerBoundStackSize = kHighsIInf;
+  batch.treeweight = 0.0;
+  batch.suboptimal = suboptimal;
+
+  std::vector<HighsInt> colPos(numCol, -1);
+  for (const OpenNode* openNode : batchNodes) {
+    HighsInt sizes[3] = {openNode->depth,
+                         HighsInt(openNode->domchgstack.size()),
+                         HighsInt(openNode->branchings.size())};
+    // a batch that is not completely written is not recorded, so the
+    // data written for it is never read
+    if (fwrite(&openNode->lower_bound, sizeof(double), 1, file) != 1 ||
+        fwrite(&openNode->estimate, sizeof(double), 1, file) != 1 ||
+        fwrite(sizes, sizeof(HighsInt), 3, file) != 3 ||
+        fwrite(openNode->domchgstack.data(), sizeof(HighsDomainChange),
+               openNode->domchgstack.size(),
+               file) != openNode->domchgstack.size() ||
+        fwrite(openNode->branchings.data(), sizeof(HighsInt),
+               openNode->branchings.size(),
+               file) != openNode->branchings.size())
+      return false;
+
+    if (openNode->lower_bound < batch.minLowerBound) {
+      batch.minLowerBound = openNode->lower_bound;
+      batch.minLowerBoundStackSize = sizes[1];
+    } else if (openNode->lower_bound == batch.minLowerBound) {
+      batch.minLowerBoundStackSize =
+          std::min(batch.minLowerBoundStackSize, sizes[1]);
+    }
+    if (!suboptimal) batch.treeweight += std::ldexp(1.0, 1 - openNode->depth);
+
+    for (const HighsDomainChange& domchg : openNode->domchgstack) {
+      HighsInt& pos = colPos[domchg.column];
+      if (pos == -1) {
+        pos = batch.columnBounds.size();
+        batch.columnBounds.push_back(SpilledColumnBounds{
+            domchg.column, 0, 0, kHighsInf, -kHighsInf, kHighsInf,
+            -kHighsInf});
+      }
+      SpilledColumnBounds& bounds = batch.columnBounds[pos];
+      if (domchg.boundtype == HighsBoundType::kLower) {
+        ++bounds.numLower;
+        bounds.minLower = std::min(bounds.minLower, domchg.boundval);
+        bounds.maxLower = std::max(bounds.maxLower, domchg.boundval);
+      } else {
+        ++bounds.numUpper;
+        bounds.minUpper = std::min(bounds.minUpper, domchg.boundval);
+        bounds.maxUpper = std::max(bounds.maxUpper, domchg.boundval);
+      }
+    }
+  }
+
+  if (fflush(file) != 0 || ferror(file) != 0) return false;
+
+  for (const SpilledColumnBounds& bounds : batch.columnBounds) {
+    spilledColLowerCount[bounds.column] += bounds.numLower;
+    spilledColUpperCount[bounds.column] += bounds.numUpper;
+  }
+  numSpilledNodes += batch.numNodes;
+  if (!suboptimal) numSpilledActive += batch.numNodes;
+  spilledBatches.push_back(std::move(batch));
+
+  return true;
+}
+
+bool HighsNodeQueue::readSpilledBatch(const SpilledBatch& batch,
+                                      std::vector<OpenNode>& batchNodes) const {
+  batchNodes.clear();
+  FILE* file = spillFile.get();
+  if (fsetpos(file, &batch.offset) != 0) return false;
+
+  batchNodes.reserve(batch.numNodes);
+  for (int64_t i = 0; i < batch.numNodes; ++i) {
+    double bounds[2];
+    HighsInt sizes[3];
+    if (fread(bounds, sizeof(double), 2, file) != 2 ||
+        fread(sizes, sizeof(HighsInt), 3, file) != 3)
+      return false;
+
+    std::vector<HighsDomainChange> domchgstack(sizes[1]);
+    std::vector<HighsInt> branchings(sizes[2]);
+    if (fread(domchgstack.data(), sizeof(HighsDomainChange), sizes[1],
+              file) != size_t(sizes[1]) ||
+        fread(branchings.data(), sizeof(HighsInt), sizes[2], file) !=
+            size_t(sizes[2]))
+      return false;
+
+    batchNodes.emplace_back(std::move(domchgstack), std::move(branchings),
+                            bounds[0], bounds[1], sizes[0]);
+  }
+
+  return true;
+}
+
+void HighsNodeQueue::removeSpilledBatch(size_t i) {
+  const SpilledBatch& batch = spilledBatches[i];
+  for (const SpilledColumnBounds& bounds : batch.columnBounds) {
+    spilledColLowerCount[bounds.column] -= bounds.numLower;
+    spilledColUpperCount[bounds.column] -= bounds.numUpper;
+  }
+  numSpilledNodes -= batch.numNodes;
+  if (!batch.suboptimal) numSpilledActive -= batch.numNodes;
+
+  if (i + 1 != spilledBatches.size())
+    spilledBatches[i] = std::move(spilledBatches.back());
+  spilledBatches.pop_back();
+}
+
+double HighsNodeQueue::pruneInfeasibleSpilledNodes(
+    const HighsDomain& globaldomain, double feastol) {
+  HighsCDouble treeweight = 0.0;
+  std::vector<OpenNode> batchNodes;
+  std::vector<const OpenNode*> keptNodes;
+
+  // batches are visited from the back, so that the batches rewritten below
+  // are not visited again
+  for (size_t i = spilledBatches.size(); i-- > 0;) {
+    bool hasInfeasible = false;
+    for (const SpilledColumnBounds& bounds : spilledBatches[i].columnBounds) {
+      if (bounds.maxLower > globaldomain.col_upper_[bounds.column] + feastol ||
+          bounds.minUpper < globaldomain.col_lower_[bounds.column] - feastol) {
+        hasInfeasible = true;
+        break;
+      }
+    }
+    if (!hasInfeasible) continue;
+
+    const bool suboptimal = spilledBatches[i].suboptimal;
+    if (!readSpilledBatch(spilledBatches[i], batchNodes)) {
+      // the batch is left as it is, and its nodes may yet be read
+      continue;
+    }
+    removeSpilledBatch(i);
+
+    keptNodes.clear();
+    for (const OpenNode& node : batchNodes) {
+      bool infeasible = false;
+      for (const HighsDomainChange& domchg : node.domchgstack) {
+        if (domchg.boundtype == HighsBoundType::kLower
+                ? domchg.boundval >
+                      globaldomain.col_upper_[domchg.column] + feastol
+                : domchg.boundval <
+                      globaldomain.col_lower_[domchg.column] - feastol) {
+          infeasible = true;
+          break;
+        }
+      }
+
+      if (!infeasible)
+        keptNodes.push_back(&node);
+      else if (!suboptimal)
+        treeweight += std::ldexp(1.0, 1 - node.depth);
+    }
+
+    if (writeSpilledBatch(keptNodes, suboptimal)) continue;
+
+    // the remaining nodes are kept in memory if the batch cannot be
+    // rewritten
+    memoryLimit = kHighsInf;
+    for (const OpenNode* keptNode : keptNodes) {
+      OpenNode& node = batchNodes[keptNode - batchNodes.data()];
+      if (suboptimal) node.estimate = kHighsInf;
+      treeweight += insertNode(std::move(node));
+    }
+  }
+
+  return double(treeweight);
+}
+
+bool HighsNodeQueue::reloadSpilledNodes() {
+  std::vector<OpenNode> batchNodes;
+  while (true) {
+    int64_t bestBatch = -1;
+    for (size_t i = 0; i < spilledBatches.size(); ++i) {
+      if (spilledBatches[i].suboptimal) continue;
+      if (spilledBatches[i].minLowerBound > optimality_limit) {
+        spilledPrunedTreeweight += spilledBatches[i].treeweight;
+        numSpilledActive -= spilledBatches[i].numNodes;
+        spilledBatches[i].suboptimal = true;
+        continue;
+      }
+      if (bestBatch == -1 || spilledBatches[i].minLowerBound <
+                                 spilledBatches[bestBatch].minLowerBound)
+        bestBatch = i;
+    }
+
+    if (bestBatch == -1) break;
+    if (lowerMin != -1 && nodes[lowerMin].lower_bound <=
+                              spilledBatches[bestBatch].minLowerBound)
+      break;
+
+    if (!readSpilledBatch(spilledBatches[bestBatch], batchNodes)) {
+      // the spilled nodes are lost, so they are discarded and the node
+      // queue records the failure, for the MIP solver to report an error
+      spillReadFailed = true;
+      while (!spilledBatches.empty())
+        removeSpilledBatch(spilledBatches.size() - 1);
+      memoryLimit = kHighsInf;
+      break;
+    }
+    removeSpilledBatch(bestBatch);
+
+    // the batch is inserted without checking the memory limit, as the nodes
+    // with the best lower bounds are about to be processed
+    for (OpenNode& node : batchNodes)
+      spilledPrunedTreeweight += insertNode(std::move(node));
+  }
+
+  return !spillReadFailed;
+}
+
 HighsNodeQueue::OpenNode&& HighsNodeQueue::popBestNode() {
+  reloadSpilledNodes();
   int64_t bestNode = hybridEstimMin;
 
   unlink(bestNode);
@@ -396,6 +771,7 @@ HighsNodeQueue::OpenNode&& HighsNodeQueue::popBestNode() {
 }
 
 HighsNodeQueue::OpenNode&& HighsNodeQueue::popBestBoundNode() {
+  reloadSpilledNodes();
   int64_t bestBoundNode = lowerMin;
 
   unlink(bestBoundNode);
@@ -406,6 +782,9 @@ HighsNodeQueue::OpenNode&& HighsNodeQueue::popBestBoundNode() {
 double HighsNodeQueue::getBestLowerBound() const {
   double lb = lowerMin == -1 ? kHighsInf : nodes[lowerMin].lower_bound;
 
+  for (const SpilledBatch& batch : spilledBatches)
+    lb = std::min(batch.minLowerBound, lb);
+
   if (suboptimalMin == -1) return lb;
 
   return std::min(nodes[suboptimalMin].lower_bound, lb);
@@ -415,6 +794,9 @@ HighsInt HighsNodeQueue::getBestBoundDomchgStackSize() const {
   HighsInt domchgStackSize = lowerMin == -1
                                  ? kHighsIInf
                                  : HighsInt(nodes[lowerMin].domchgstack.size());
+  for (const SpilledBatch& batch : spilledBatches)
+    domchgStackSize = std::min(batch.minLowerBoundStackSize, domchgStackSize);
+
   if (suboptimalMin == -1) return domchgStackSize;
 
   return std::min(HighsInt(nodes[suboptimalMin].domchgstack.size()),
@@ -443,4 +825,14 @@ void HighsNodeQueue::clear() {
     (*this).optimality_limit = nodequeue.optimality_limit;
     (*this).numCol = nodequeue.numCol;
   }
+
+  numStoredDomchgs = 0;
+  numStoredBranchings = 0;
+  numSpilledNodes = 0;
+  numSpilledActive = 0;
+  spilledPrunedTreeweight = 0.0;
+  spilledBatches.clear();
+  spilledColLowerCount.assign(numCol, 0);
+  spilledColUpperCount.assign(numCol, 0);
+  spillFile.reset();
 }
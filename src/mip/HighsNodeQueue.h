@@ -14,6 +14,7 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstdio>
 #include <memory>
 #include <queue>
 #include <set>
@@ -211,6 +212,53 @@ class HighsNodeQueue {
   double optimality_limit = kHighsInf;
   HighsInt numCol = 0;
 
+  // When the estimated memory of the stored nodes exceeds the limit, the
+  // nodes with the worst lower bounds are written in batches to a temporary
+  // file. A batch is read back once its best lower bound is better than the
+  // best lower bound of the nodes in memory.
+  //
+  // The bound changes of the nodes of a batch on each column are summarized,
+  // so that spilled nodes count towards the number of nodes of the columns,
+  // and so that the batch is only read to prune infeasible nodes if it has
+  // any.
+  struct SpilledColumnBounds {
+    HighsInt column;
+    HighsInt numLower;
+    HighsInt numUpper;
+    double minLower;
+    double maxLower;
+    double minUpper;
+    double maxUpper;
+  };
+
+  struct SpilledBatch {
+    // fpos_t rather than the long of ftell, which is 32 bits on Windows
+    fpos_t offset;
+    int64_t numNodes;
+    double minLowerBound;
+    HighsInt minLowerBoundStackSize;
+    double treeweight;
+    bool suboptimal;
+    std::vector<SpilledColumnBounds> columnBounds;
+  };
+
+  struct FileCloser {
+    void operator()(FILE* file) const { fclose(file); }
+  };
+
+  double memoryLimit = kHighsInf;
+  int64_t numStoredDomchgs = 0;
+  int64_t numStoredBranchings = 0;
+  int64_t numSpilledNodes = 0;
+  int64_t numSpilledActive = 0;
+  int64_t numSpilledTotal = 0;
+  bool spillReadFailed = false;
+  HighsCDouble spilledPrunedTreeweight = 0.0;
+  std::unique_ptr<FILE, FileCloser> spillFile;
+  std::vector<SpilledBatch> spilledBatches;
+  std::vector<int64_t> spilledColLowerCount;
+  std::vector<int64_t> spilledColUpperCount;
+
   void link_estim(int64_t node);
 
   void unlink_estim(int64_t node);
@@ -231,11 +279,43 @@ class HighsNodeQueue {
 
   void unlink(int64_t node);
 
+  std::vector<uint8_t> getFreeSlotMask() const;
+
+  static double domchgMemory();
+
+  static double nodeMemory(const OpenNode& node);
+
+  double estimatedMemory() const;
+
+  double insertNode(OpenNode&& node);
+
+  void spillNodes();
+
+  bool writeSpilledBatch(const std::vector<const OpenNode*>& batchNodes,
+                         bool suboptimal);
+
+  bool readSpilledBatch(const SpilledBatch& batch,
+                        std::vector<OpenNode>& batchNodes) const;
+
+  void removeSpilledBatch(size_t i);
+
+  double pruneInfeasibleSpilledNodes(const HighsDomain& globaldomain,
+                                     double feastol);
+
  public:
+  /// reads the spilled batches back into memory while they contain the node
+  /// with the best lower bound, returning false if spilled nodes were lost
+  /// since they could not be read
+  bool reloadSpilledNodes();
+
   void setOptimalityLimit(double optimality_limit) {
     this->optimality_limit = optimality_limit;
   }
 
+  void setMemoryLimit(double limitInMb) {
+    memoryLimit = limitInMb * 1024.0 * 1024.0;
+  }
+
   double performBounding(double upper_limit);
 
   void setNumCol(HighsInt numcol);
@@ -249,13 +329,14 @@ class HighsNodeQueue {
   OpenNode&& popBestBoundNode();
 
   int64_t numNodesUp(HighsInt col) const {
-    return colLowerNodesPtr.get()[col].size();
+    return colLowerNodesPtr.get()[col].size() + spilledColLowerCount[col];
   }
 
   int64_t numNodesDown(HighsInt col) const {
-    return colUpperNodesPtr.get()[col].size();
+    return colUpperNodesPtr.get()[col].size() + spilledColUpperCount[col];
   }
 
+  /// the following only consider the nodes in memory
   int64_t numNodesUp(HighsInt col, double val) const {
     assert(numCol > col);
     auto colLowerNodes = colLowerNodesPtr.get();
@@ -286,17 +367,42 @@ class HighsNodeQueue {
 
   double getBestLowerBound() const;
 
+  /// calls f for every open node, including the suboptimal nodes, whose
+  /// estimate is infinite, and the nodes that are currently spilled to the
+  /// temporary file
+  template <typename F>
+  void forEachNode(F&& f) const {
+    std::vector<uint8_t> isFree = getFreeSlotMask();
+    for (size_t i = 0; i < nodes.size(); ++i)
+      if (!isFree[i]) f(nodes[i]);
+
+    std::vector<OpenNode> batchNodes;
+    for (const SpilledBatch& batch : spilledBatches) {
+      if (!readSpilledBatch(batch, batchNodes)) continue;
+      for (const OpenNode& node : batchNodes) f(node);
+    }
+  }
+
   HighsInt getBestBoundDomchgStackSize() const;
 
   void clear();
 
-  int64_t numNodes() const { return nodes.size() - freeslots.size(); }
+  int64_t numNodes() const {
+    return nodes.size() - freeslots.size() + numSpilledNodes;
+  }
 
   int64_t numActiveNodes() const {
-    return nodes.size() - freeslots.size() - numSuboptimal;
+    return nodes.size() - freeslots.size() - numSuboptimal + numSpilledActive;
   }
 
   bool empty() const { return numActiveNodes() == 0; }
+
+  /// the number of nodes written to the temporary file so far
+  int64_t numNodesSpilled() const { return numSpilledTotal; }
+
+  /// whether open nodes were lost since they could not be read back from the
+  /// temporary file
+  bool spilledNodesLost() const { return spillReadFailed; }
 };
 
 template <typename T, typename U>
@@ -33,6 +33,8 @@ class HighsPathSeparator : public HighsSeparator {
                           HighsTransformedLp& transLp,
                           HighsCutPool& cutpool) override;
 
+  bool isThreadSafe() const override { return true; }
+
   HighsPathSeparator(const HighsMipSolver& mipsolver)
       : HighsSeparator(mipsolver, "PathAggr sepa", "Agg") {
     randgen.initialise(mipsolver.options_mip_->random_seed);
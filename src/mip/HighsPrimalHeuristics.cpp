@@ -37,13 +37,68 @@
 HighsPrimalHeuristics::HighsPrimalHeuristics(HighsMipSolver& mipsolver)
     : mipsolver(mipsolver),
       lp_iterations(0),
-      randgen(mipsolver.options_mip_->random_seed) {
+      randgen(mipsolver.options_mip_->random_seed),
+      schedulerandgen(mipsolver.options_mip_->random_seed) {
   successObservations = 0;
   numSuccessObservations = 0;
   infeasObservations = 0;
   numInfeasObservations = 0;
 }
 
+HighsPrimalHeuristics::HeuristicCall::HeuristicCall(
+    HighsPrimalHeuristics& heuristics, Heuristic heuristic)
+    : heuristics(heuristics),
+      heuristic(heuristic),
+      startLpIterations(heuristics.lp_iterations),
+      startNumImprovingSols(heuristics.mipsolver.mipdata_->numImprovingSols) {}
+
+HighsPrimalHeuristics::HeuristicCall::~HeuristicCall() {
+  HeuristicStatistics& stats = heuristics.heuristicStats[heuristic];
+  ++stats.numCalls;
+  stats.lpIterations += heuristics.lp_iterations - startLpIterations;
+  if (heuristics.mipsolver.mipdata_->numImprovingSols != startNumImprovingSols)
+    ++stats.numSuccess;
+}
+
+bool HighsPrimalHeuristics::heuristicScheduled(Heuristic heuristic) {
+  // Unless scheduling is switched on, every heuristic is always called.
+  // Otherwise each heuristic is called unconditionally for its first few
+  // calls, after which it is called with a probability that grows with its
+  // (smoothed) rate of finding improving solutions. Heuristics that keep
+  // failing are still called with a probability given by the heuristic
+  // effort, and the calls that are skipped are counted
+  if (!mipsolver.options_mip_->mip_heuristic_scheduling) return true;
+  const HighsInt kMinCalls = 5;
+  HeuristicStatistics& stats = heuristicStats[heuristic];
+  if (stats.numCalls < kMinCalls) return true;
+  double successRate = (stats.numSuccess + 1.0) / (stats.numCalls + 2.0);
+  double probability = std::min(
+      1.0, 2.0 * successRate + mipsolver.mipdata_->heuristic_effort);
+  if (schedulerandgen.fraction() < probability) return true;
+  ++stats.numSkipped;
+  return false;
+}
+
+void HighsPrimalHeuristics::reportStatistics() const {
+  const char* names[kNumHeuristics] = {"Randomized rounding",
+                                       "RENS",
+                                       "RINS",
+                                       "Feasibility pump",
+                                       "Central rounding",
+                                       "Root reduced cost"};
+  highsLogDev(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
+              "%-20s %8s %8s %8s %12s\n", "Heuristic", "Calls", "Success",
+              "Skipped", "LP iters");
+  for (HighsInt heuristic = 0; heuristic < kNumHeuristics; ++heuristic) {
+    const HeuristicStatistics& stats = heuristicStats[heuristic];
+    if (stats.numCalls == 0 && stats.numSkipped == 0) continue;
+    highsLogDev(mipsolver.options_mip_->log_options, HighsLogType::kInfo,
+                "%-20s %8d %8d %8d %12" PRId64 "\n", names[heuristic],
+                int(stats.numCalls), int(stats.numSuccess),
+                int(stats.numSkipped), stats.lpIterations);
+  }
+}
+
 void HighsPrimalHeuristics::setupIntCols() {
   intcols = mipsolver.mipdata_->integer_cols;
 
@@ -126,6 +181,7 @@ bool HighsPrimalHeuristics::solveSubMip(
   }
 
   submipoptions.presolve = "on";
+  submipoptions.presolve_log_file = "";
   submipoptions.mip_detect_symmetry = false;
   submipoptions.mip_heuristic_effort = 0.8;
   // setup solver and run it
@@ -141,6 +197,7 @@ bool HighsPrimalHeuristics::solveSubMip(
   submipsolver.pscostinit = &pscostinit;
   submipsolver.clqtableinit = &mipsolver.mipdata_->cliquetable;
   submipsolver.implicinit = &mipsolver.mipdata_->implications;
+  submipsolver.cutpoolinit = &mipsolver.mipdata_->cutpool;
   submipsolver.run();
   if (submipsolver.mipdata_) {
     double numUnfixed = mipsolver.mipdata_->integral_cols.size() +
@@ -238,6 +295,7 @@ class HeuristicNeighbourhood {
 };
 
 void HighsPrimalHeuristics::rootReducedCost() {
+  HeuristicCall call(*this, kHeuristicRootReducedCost);
   std::vector<std::pair<double, HighsDomainChange>> lurkingBounds =
       mipsolver.mipdata_->redcostfixing.getLurkingBounds(mipsolver);
   if (10 * lurkingBounds.size() < mipsolver.mipdata_->integral_cols.size())
@@ -296,6 +354,7 @@ void HighsPrimalHeuristics::rootReducedCost() {
 }
 
 void HighsPrimalHeuristics::RENS(const std::vector<double>& tmp) {
+  HeuristicCall call(*this, kHeuristicRens);
   HighsPseudocost pscost(mipsolver.mipdata_->pseudocost);
   HighsSearch heur(mipsolver, pscost);
   HighsDomain& localdom = heur.getLocalDomain();
@@ -541,6 +600,7 @@ retry:
 
 void HighsPrimalHeuristics::RINS(const std::vector<double>& relaxationsol) {
   if (int(relaxationsol.size()) != mipsolver.numCol()) return;
+  HeuristicCall call(*this, kHeuristicRins);
 
   intcols.erase(std::remove_if(intcols.begin(), intcols.end(),
                                [&](HighsInt i) {
@@ -945,6 +1005,7 @@ bool HighsPrimalHeuristics::linesearchRounding(
 void HighsPrimalHeuristics::randomizedRounding(
     const std::vector<double>& relaxationsol) {
   if (int(relaxationsol.size()) != mipsolver.numCol()) return;
+  HeuristicCall call(*this, kHeuristicRandomizedRounding);
 
   auto localdom = mipsolver.mipdata_->domain;
 
@@ -1008,6 +1069,7 @@ void HighsPrimalHeuristics::randomizedRounding(
 }
 
 void HighsPrimalHeuristics::feasibilityPump() {
+  HeuristicCall call(*this, kHeuristicFeasibilityPump);
   HighsLpRelaxation lprelax(mipsolver.mipdata_->lp);
   std::unordered_set<std::vector<HighsInt>, HighsVectorHasher, HighsVectorEqual>
       referencepoints;
@@ -1116,6 +1178,7 @@ void HighsPrimalHeuristics::feasibilityPump() {
 void HighsPrimalHeuristics::centralRounding() {
   if (HighsInt(mipsolver.mipdata_->analyticCenter.size()) != mipsolver.numCol())
     return;
+  HeuristicCall call(*this, kHeuristicCentralRounding);
 
   if (!mipsolver.mipdata_->firstlpsol.empty())
     linesearchRounding(mipsolver.mipdata_->firstlpsol,
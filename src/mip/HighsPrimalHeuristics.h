@@ -11,6 +11,7 @@
 #ifndef HIGHS_PRIMAL_HEURISTICS_H_
 #define HIGHS_PRIMAL_HEURISTICS_H_
 
+#include <array>
 #include <vector>
 
 #include "lp_data/HStruct.h"
@@ -20,16 +21,52 @@
 class HighsMipSolver;
 
 class HighsPrimalHeuristics {
+ public:
+  enum Heuristic {
+    kHeuristicRandomizedRounding = 0,
+    kHeuristicRens,
+    kHeuristicRins,
+    kHeuristicFeasibilityPump,
+    kHeuristicCentralRounding,
+    kHeuristicRootReducedCost,
+    kNumHeuristics
+  };
+
+  struct HeuristicStatistics {
+    HighsInt numCalls = 0;
+    HighsInt numSuccess = 0;
+    HighsInt numSkipped = 0;
+    int64_t lpIterations = 0;
+  };
+
  private:
   HighsMipSolver& mipsolver;
   size_t lp_iterations;
 
+  std::array<HeuristicStatistics, kNumHeuristics> heuristicStats;
+
+  // Records the LP iterations of a heuristic call and whether it found an
+  // improving solution when it goes out of scope
+  class HeuristicCall {
+    HighsPrimalHeuristics& heuristics;
+    Heuristic heuristic;
+    size_t startLpIterations;
+    HighsInt startNumImprovingSols;
+
+   public:
+    HeuristicCall(HighsPrimalHeuristics& heuristics, Heuristic heuristic);
+    ~HeuristicCall();
+  };
+
   double successObservations;
   HighsInt numSuccessObservations;
   double infeasObservations;
   HighsInt numInfeasObservations;
 
   HighsRandom randgen;
+  // draws whether heuristics are scheduled, so that scheduling does not
+  // change the random numbers used by the heuristics
+  HighsRandom schedulerandgen;
 
   std::vector<HighsInt> intcols;
 
@@ -57,6 +94,14 @@ class HighsPrimalHeuristics {
 
   void flushStatistics();
 
+  bool heuristicScheduled(Heuristic heuristic);
+
+  const HeuristicStatistics& getStatistics(Heuristic heuristic) const {
+    return heuristicStats[heuristic];
+  }
+
+  void reportStatistics() const;
+
   bool tryRoundedPoint(const std::vector<double>& point, char source);
 
   bool linesearchRounding(const std::vector<double>& point1,
@@ -390,6 +390,12 @@ HighsInt HighsSearch::selectBranchingCandidate(int64_t maxSbIters,
     return best;
   };
 
+  if (!inheuristic && nodestack.size() == 1 &&
+      mipsolver.mipdata_->num_nodes == 0 &&
+      highs::parallel::num_threads() > 1)
+    evalUnreliableBranchCands(maxSbIters, upscore, downscore, upscorereliable,
+                              downscorereliable, upbound, downbound);
+
   HighsLpRelaxation::Playground playground = lp->playground();
 
   while (true) {
@@ -805,6 +811,179 @@ HighsInt HighsSearch::selectBranchingCandidate(int64_t maxSbIters,
   }
 }
 
+void HighsSearch::evalUnreliableBranchCands(
+    int64_t maxSbIters, std::vector<double>& upscore,
+    std::vector<double>& downscore, std::vector<uint8_t>& upscorereliable,
+    std::vector<uint8_t>& downscorereliable, std::vector<double>& upbound,
+    std::vector<double>& downbound) {
+  // Evaluate the strong branching LPs of the unreliable candidates with
+  // the best pseudocost scores concurrently. Each task solves the LPs of
+  // its candidates on a copy of the LP relaxation, warm started from the
+  // basis of the node, with the branching bound change propagated on a
+  // copy of the local domain. Only the objective values of LPs solved to
+  // optimality are used, and these are merged in candidate order. Infeasible
+  // and cut off branches are left to the sequential strong branching loop,
+  // which also performs the conflict analysis and pruning. Since this is
+  // only done with more than one thread, and the LP iteration counts depend
+  // on how the candidates are split into tasks, the search path (though not
+  // the optimal objective) can depend on the number of threads.
+  const HighsInt kMaxCands = 16;
+  if (getStrongBranchingLpIterations() >= maxSbIters) return;
+  const HighsBasis& nodeBasis = lp->getLpSolver().getBasis();
+  if (!nodeBasis.valid || !lp->getLpSolver().getInfo().valid) return;
+
+  const auto& fracints = lp->getFractionalIntegers();
+  HighsInt numfrac = fracints.size();
+  std::vector<std::pair<double, HighsInt>> unreliable;
+  for (HighsInt k = 0; k != numfrac; ++k) {
+    if (upscorereliable[k] && downscorereliable[k]) continue;
+    unreliable.emplace_back(
+        -pseudocost.getScore(fracints[k].first, fracints[k].second), k);
+  }
+  if (unreliable.size() < 2) return;
+  std::sort(unreliable.begin(), unreliable.end());
+  HighsInt numCands = std::min(HighsInt(unreliable.size()), kMaxCands);
+
+  struct BranchEval {
+    double objective = kHighsInf;
+    int64_t lpIterations = 0;
+    bool solved = false;
+  };
+  // entry 2 * i gives the down branch and 2 * i + 1 the up branch of the
+  // i-th candidate
+  std::vector<BranchEval> evals(2 * numCands);
+
+  HighsInt numTasks =
+      std::min(HighsInt{highs::parallel::num_threads()}, numCands);
+  // the domain copies register themselves with the cut and conflict pools,
+  // so they are created before the parallel loop. The pools are shared, so
+  // the age resets of the copies are deferred until after the loop
+  std::vector<HighsDomain> taskdoms(numTasks, localdom);
+  for (HighsDomain& dom : taskdoms) dom.setDeferAgeResets(true);
+  const double timeLimit = mipsolver.options_mip_->time_limit -
+                           mipsolver.timer_.read(mipsolver.timer_.solve_clock);
+  const double feastol = mipsolver.mipdata_->feastol;
+  // each task may use the remaining strong branching iterations, and the
+  // LPs are cut off at the upper limit since branches with a larger
+  // objective are not used
+  const int64_t sbItersLeft = maxSbIters - getStrongBranchingLpIterations();
+  const double upperLimit = mipsolver.mipdata_->upper_limit;
+
+  highs::parallel::for_each(0, numTasks, [&](HighsInt start, HighsInt end) {
+    for (HighsInt task = start; task != end; ++task) {
+      HighsDomain& dom = taskdoms[task];
+      dom.clearChangedCols();
+      Highs lpsolver;
+      lpsolver.passOptions(lp->getLpSolver().getOptions());
+      lpsolver.setOptionValue("output_flag", false);
+      lpsolver.setOptionValue("time_limit", timeLimit);
+      lpsolver.setOptionValue("objective_bound", upperLimit);
+      lpsolver.passModel(lp->getLpSolver().getLp());
+      const HighsLp& lpModel = lpsolver.getLp();
+      int64_t taskIters = 0;
+
+      std::vector<double> nodeLb;
+      std::vector<double> nodeUb;
+      std::vector<double> lb;
+      std::vector<double> ub;
+      for (HighsInt i = task * numCands / numTasks;
+           i != (task + 1) * numCands / numTasks; ++i) {
+        HighsInt k = unreliable[i].second;
+        HighsInt col = fracints[k].first;
+        for (HighsInt up = 0; up != 2; ++up) {
+          if (up ? upscorereliable[k] : downscorereliable[k]) continue;
+          if (taskIters >= sbItersLeft) break;
+          HighsDomainChange domchg =
+              up ? HighsDomainChange{std::ceil(fracints[k].second), col,
+                                     HighsBoundType::kLower}
+                 : HighsDomainChange{std::floor(fracints[k].second), col,
+                                     HighsBoundType::kUpper};
+          dom.changeBound(domchg);
+          if (!dom.infeasible()) dom.propagate();
+          if (dom.infeasible()) {
+            dom.backtrack();
+            dom.clearChangedCols();
+            continue;
+          }
+
+          // as in HighsLpRelaxation::flushDomain(), only the bounds of
+          // integer columns are passed to the LP
+          dom.removeContinuousChangedCols();
+          const std::vector<HighsInt>& chgCols = dom.getChangedCols();
+          HighsInt numChgCols = chgCols.size();
+          nodeLb.resize(numChgCols);
+          nodeUb.resize(numChgCols);
+          lb.resize(numChgCols);
+          ub.resize(numChgCols);
+          for (HighsInt j = 0; j != numChgCols; ++j) {
+            nodeLb[j] = lpModel.col_lower_[chgCols[j]];
+            nodeUb[j] = lpModel.col_upper_[chgCols[j]];
+            lb[j] = dom.col_lower_[chgCols[j]];
+            ub[j] = dom.col_upper_[chgCols[j]];
+          }
+          lpsolver.changeColsBounds(numChgCols, chgCols.data(), lb.data(),
+                                    ub.data());
+          const int64_t iterLimit =
+              std::min(sbItersLeft - taskIters, int64_t{kHighsIInf});
+          lpsolver.setOptionValue("simplex_iteration_limit",
+                                  HighsInt(iterLimit));
+          lpsolver.setBasis(nodeBasis);
+          lpsolver.run();
+
+          BranchEval& eval = evals[2 * i + up];
+          const HighsInfo& info = lpsolver.getInfo();
+          eval.lpIterations =
+              std::max(HighsInt{0}, info.simplex_iteration_count);
+          taskIters += eval.lpIterations;
+          eval.solved =
+              lpsolver.getModelStatus() == HighsModelStatus::kOptimal &&
+              info.max_primal_infeasibility <= feastol &&
+              info.max_dual_infeasibility <= feastol;
+          if (eval.solved) eval.objective = info.objective_function_value;
+
+          // restore the bounds of the node
+          lpsolver.changeColsBounds(numChgCols, chgCols.data(), nodeLb.data(),
+                                    nodeUb.data());
+          dom.backtrack();
+          dom.clearChangedCols();
+        }
+      }
+    }
+  });
+
+  for (HighsDomain& dom : taskdoms) dom.applyDeferredAgeResets();
+
+  for (HighsInt i = 0; i != numCands; ++i) {
+    HighsInt k = unreliable[i].second;
+    HighsInt col = fracints[k].first;
+    double fracval = fracints[k].second;
+    for (HighsInt up = 0; up != 2; ++up) {
+      const BranchEval& eval = evals[2 * i + up];
+      lpiterations += eval.lpIterations;
+      sblpiterations += eval.lpIterations;
+      if (!eval.solved || eval.objective > mipsolver.mipdata_->optimality_limit)
+        continue;
+
+      double objdelta = std::max(eval.objective - lp->getObjective(), 0.0);
+      if (objdelta <= mipsolver.mipdata_->epsilon) objdelta = 0.0;
+      if (up) {
+        upscore[k] = objdelta;
+        upscorereliable[k] = true;
+        upbound[k] = std::max(upbound[k], eval.objective);
+        markBranchingVarUpReliableAtNode(col);
+        pseudocost.addObservation(col, std::ceil(fracval) - fracval, objdelta);
+      } else {
+        downscore[k] = objdelta;
+        downscorereliable[k] = true;
+        downbound[k] = std::max(downbound[k], eval.objective);
+        markBranchingVarDownReliableAtNode(col);
+        pseudocost.addObservation(col, std::floor(fracval) - fracval,
+                                  objdelta);
+      }
+    }
+  }
+}
+
 const HighsSearch::NodeData* HighsSearch::getParentNodeData() const {
   if (nodestack.size() <= 1) return nullptr;
 
@@ -205,7 +205,13 @@ class HighsSearch {
   HighsInt selectBranchingCandidate(int64_t maxSbIters, double& downNodeLb,
                                     double& upNodeLb);
 
-  void evalUnreliableBranchCands();
+  void evalUnreliableBranchCands(int64_t maxSbIters,
+                                 std::vector<double>& upscore,
+                                 std::vector<double>& downscore,
+                                 std::vector<uint8_t>& upscorereliable,
+                                 std::vector<uint8_t>& downscorereliable,
+                                 std::vector<double>& upbound,
+                                 std::vector<double>& downbound);
 
   const NodeData* getParentNodeData() const;
 
@@ -24,6 +24,7 @@
 #include "mip/HighsPathSeparator.h"
 #include "mip/HighsTableauSeparator.h"
 #include "mip/HighsTransformedLp.h"
+#include "parallel/HighsParallel.h"
 
 HighsSeparation::HighsSeparation(const HighsMipSolver& mipsolver) {
   implBoundClock = mipsolver.timer_.clock_def("Implbound sepa", "Ibd");
@@ -111,7 +112,15 @@ HighsInt HighsSeparation::separationRound(HighsDomain& propdomain,
   }
   HighsLpAggregator lpAggregator(*lp);
 
+  // separators that only read the shared data are collected and run
+  // concurrently afterwards, the others are run here on the global cut pool
+  std::vector<HighsSeparator*> concurrentSeparators;
+  const bool runConcurrently = highs::parallel::num_threads() > 1;
   for (const std::unique_ptr<HighsSeparator>& separator : separators) {
+    if (runConcurrently && separator->isThreadSafe()) {
+      concurrentSeparators.push_back(separator.get());
+      continue;
+    }
     separator->run(*lp, lpAggregator, transLp, mipdata.cutpool);
     if (mipdata.domain.infeasible()) {
       status = HighsLpRelaxation::Status::kInfeasible;
@@ -119,6 +128,14 @@ HighsInt HighsSeparation::separationRound(HighsDomain& propdomain,
     }
   }
 
+  if (!concurrentSeparators.empty()) {
+    runConcurrentSeparators(concurrentSeparators, transLp);
+    if (mipdata.domain.infeasible()) {
+      status = HighsLpRelaxation::Status::kInfeasible;
+      return 0;
+    }
+  }
+
   numboundchgs = propagateAndResolve();
   if (numboundchgs == -1)
     return 0;
@@ -143,6 +160,61 @@ HighsInt HighsSeparation::separationRound(HighsDomain& propdomain,
   return ncuts;
 }
 
+void HighsSeparation::runConcurrentSeparators(
+    const std::vector<HighsSeparator*>& concurrentSeparators,
+    const HighsTransformedLp& transLp) {
+  const HighsMipSolver& mipsolver = lp->getMipSolver();
+  HighsCutPool& cutpool = mipsolver.mipdata_->cutpool;
+  HighsInt numSeparators = concurrentSeparators.size();
+
+  // each separator gets its own copy of the transformed LP, its own
+  // aggregator and a local cut pool which are set up sequentially as the
+  // transformed LP and aggregator use internal work vectors
+  std::vector<HighsTransformedLp> localTransLps(numSeparators, transLp);
+  std::vector<HighsLpAggregator> localAggregators(numSeparators,
+                                                  HighsLpAggregator(*lp));
+  std::vector<std::unique_ptr<HighsCutPool>> localCutpools;
+  localCutpools.reserve(numSeparators);
+  for (HighsInt i = 0; i < numSeparators; ++i)
+    localCutpools.emplace_back(
+        new HighsCutPool(mipsolver.numCol(),
+                         mipsolver.options_mip_->mip_pool_age_limit,
+                         mipsolver.options_mip_->mip_pool_soft_limit));
+
+  highs::parallel::for_each(
+      0, numSeparators,
+      [&](HighsInt start, HighsInt end) {
+        for (HighsInt i = start; i < end; ++i)
+          concurrentSeparators[i]->run(*lp, localAggregators[i],
+                                       localTransLps[i], *localCutpools[i]);
+      },
+      1);
+
+  // merge the cuts into the global cut pool in the order of the separators,
+  // so that the result does not depend on the scheduling of the tasks. The
+  // global cut pool filters duplicates found by different separators and
+  // extracts cliques from the merged cuts.
+  std::vector<HighsInt> cutInds;
+  std::vector<double> cutVals;
+  for (HighsInt i = 0; i < numSeparators; ++i) {
+    const HighsCutPool& localCutpool = *localCutpools[i];
+    const HighsDynamicRowMatrix& cutMatrix = localCutpool.getMatrix();
+    const HighsInt* ARindex = cutMatrix.getARindex();
+    const double* ARvalue = cutMatrix.getARvalue();
+    for (HighsInt cut = 0; cut < cutMatrix.getNumRows(); ++cut) {
+      HighsInt start = cutMatrix.getRowStart(cut);
+      HighsInt end = cutMatrix.getRowEnd(cut);
+      if (start == end) continue;
+      cutInds.assign(ARindex + start, ARindex + end);
+      cutVals.assign(ARvalue + start, ARvalue + end);
+      cutpool.addCut(mipsolver, cutInds.data(), cutVals.data(), end - start,
+                     localCutpool.getRhs()[cut],
+                     localCutpool.cutIsIntegral(cut));
+      if (mipsolver.mipdata_->domain.infeasible()) return;
+    }
+  }
+}
+
 void HighsSeparation::separate(HighsDomain& propdomain) {
   HighsLpRelaxation::Status status = lp->getStatus();
   const HighsMipSolver& mipsolver = lp->getMipSolver();
@@ -21,6 +21,7 @@
 class HighsMipSolver;
 class HighsImplications;
 class HighsCliqueTable;
+class HighsTransformedLp;
 
 class HighsSeparation {
  public:
@@ -34,6 +35,10 @@ class HighsSeparation {
   HighsSeparation(const HighsMipSolver& mipsolver);
 
  private:
+  void runConcurrentSeparators(
+      const std::vector<HighsSeparator*>& concurrentSeparators,
+      const HighsTransformedLp& transLp);
+
   HighsInt implBoundClock;
   HighsInt cliqueClock;
   std::vector<std::unique_ptr<HighsSeparator>> separators;
@@ -44,6 +44,11 @@ class HighsSeparator {
   void run(HighsLpRelaxation& lpRelaxation, HighsLpAggregator& lpAggregator,
            HighsTransformedLp& transLp, HighsCutPool& cutpool);
 
+  /// whether the separator only reads shared solver data, so that it can run
+  /// concurrently with other separators given its own aggregator, transformed
+  /// LP, and cut pool
+  virtual bool isThreadSafe() const { return false; }
+
   HighsInt getNumCutsFound() const { return numCutsFound; }
 
   HighsInt getNumCalls() const { return numCalls; }
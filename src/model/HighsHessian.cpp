@@ -150,6 +150,16 @@ HighsInt HighsHessian::numNz() const {
   return this->start_[this->dim_];
 }
 
+bool HighsHessian::isDiagonal() const {
+  for (HighsInt iCol = 0; iCol < this->dim_; iCol++) {
+    for (HighsInt iEl = this->start_[iCol]; iEl < this->start_[iCol + 1];
+         iEl++) {
+      if (this->index_[iEl] != iCol && this->value_[iEl]) return false;
+    }
+  }
+  return true;
+}
+
 void HighsHessian::print() const {
   HighsInt num_nz = this->numNz();
   printf("Hessian of dimension %" HIGHSINT_FORMAT " and %" HIGHSINT_FORMAT
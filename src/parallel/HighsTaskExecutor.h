@@ -166,6 +166,9 @@ class HighsTaskExecutor {
       }
 
       executorHandle.ptr.reset();
+      // the worker deque of this thread belonged to the executor, so
+      // reset it to show that there is no scheduler
+      threadLocalWorkerDeque() = nullptr;
     }
   }
 
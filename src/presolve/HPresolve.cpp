@@ -26,6 +26,8 @@
 #include "mip/HighsImplications.h"
 #include "mip/HighsMipSolverData.h"
 #include "mip/HighsObjectiveFunction.h"
+#include "parallel/HighsCombinable.h"
+#include "parallel/HighsParallel.h"
 #include "presolve/HighsPostsolveStack.h"
 #include "test/DevKkt.h"
 #include "util/HFactor.h"
@@ -44,6 +46,14 @@
     if (__result != presolve::HPresolve::Result::kOk) return __result; \
   } while (0)
 
+#define HPRESOLVE_LOGGED_CALL(passType, presolveCall)                  \
+  do {                                                                 \
+    startPresolvePass(passType);                                       \
+    HPresolve::Result __result = presolveCall;                         \
+    stopPresolvePass(passType);                                        \
+    if (__result != presolve::HPresolve::Result::kOk) return __result; \
+  } while (0)
+
 namespace presolve {
 
 #ifndef NDEBUG
@@ -126,6 +136,7 @@ bool HPresolve::okSetInput(HighsLp& model_, const HighsOptions& options_,
   if (!okReserve(changedColIndices, model->num_col_)) return false;
   numDeletedCols = 0;
   numDeletedRows = 0;
+  numNonzerosTouched = 0;
   // initialize substitution opportunities
   for (HighsInt row = 0; row != model->num_row_; ++row) {
     if (!isDualImpliedFree(row)) continue;
@@ -364,6 +375,7 @@ bool HPresolve::isImpliedInteger(HighsInt col) {
 }
 
 void HPresolve::link(HighsInt pos) {
+  ++numNonzerosTouched;
   Anext[pos] = colhead[Acol[pos]];
   Aprev[pos] = -1;
   colhead[Acol[pos]] = pos;
@@ -389,6 +401,7 @@ void HPresolve::link(HighsInt pos) {
 }
 
 void HPresolve::unlink(HighsInt pos) {
+  ++numNonzerosTouched;
   HighsInt next = Anext[pos];
   HighsInt prev = Aprev[pos];
 
@@ -954,35 +967,92 @@ void HPresolve::shrinkProblem(HighsPostsolveStack& postsolve_stack) {
 
 HPresolve::Result HPresolve::dominatedColumns(
     HighsPostsolveStack& postsolve_stack) {
-  std::vector<std::pair<uint32_t, uint32_t>> signatures(model->num_col_);
+  // the signatures are bitmaps of the hashed rows in which a column has a
+  // negative (first) or positive (second) coefficient when the row is
+  // normalized to <= form. They rule out most candidate pairs before the
+  // column vectors need to be compared
+  std::vector<std::pair<uint64_t, uint64_t>> signatures(model->num_col_);
 
   auto isBinary = [&](HighsInt i) {
     return model->integrality_[i] == HighsVarType::kInteger &&
            model->col_lower_[i] == 0.0 && model->col_upper_[i] == 1.0;
   };
 
-  auto addSignature = [&](HighsInt row, HighsInt col, uint32_t rowLowerFinite,
-                          uint32_t rowUpperFinite) {
-    HighsInt rowHashedPos = (HighsHashHelpers::hash(row) >> 59);
-    assert(rowHashedPos < 32);
+  auto addSignature = [&](HighsInt row, HighsInt col, uint64_t rowLowerFinite,
+                          uint64_t rowUpperFinite) {
+    HighsInt rowHashedPos = (HighsHashHelpers::hash(row) >> 58);
+    assert(rowHashedPos < 64);
     signatures[col].first |= rowLowerFinite << rowHashedPos;
     signatures[col].second |= rowUpperFinite << rowHashedPos;
   };
 
+  // returns whether the coefficient aj of the dominating column and the
+  // coefficient ak of the dominated column in the given row allow for
+  // domination
+  auto checkCoefficients = [&](HighsInt row, double aj, double ak) {
+    if (model->row_lower_[row] != -kHighsInf &&
+        model->row_upper_[row] != kHighsInf) {
+      // the row is an equality or ranged row, therefore the coefficients must
+      // be parallel, otherwise one of the inequalities given by the row rules
+      // out domination
+      return std::abs(aj - ak) <= options->small_matrix_value;
+    }
+
+    // normalize row to a <= constraint
+    if (model->row_upper_[row] == kHighsInf) {
+      aj = -aj;
+      ak = -ak;
+    }
+
+    // the coefficient of the dominating column needs to be smaller than or
+    // equal to the coefficient of the dominated column
+    return aj <= ak + options->small_matrix_value;
+  };
+
+  // the column vector of the column j for which domination is currently
+  // checked is scattered into a dense array so that the check against a
+  // candidate column k only needs to loop over the column vector of k and
+  // does not modify the row trees. This allows checking candidates in
+  // parallel
+  std::vector<double> denseColJ(model->num_row_);
+  std::vector<HighsInt> denseColJRows;
+  HighsInt numZeroViolations[2];
+  HighsInt scatteredColJ = -1;
+
+  auto scatterColJ = [&](HighsInt j) {
+    for (HighsInt row : denseColJRows) denseColJ[row] = 0.0;
+    denseColJRows.clear();
+    scatteredColJ = j;
+    // count the rows in which the coefficients of j would not allow
+    // domination if k has no entry, for scaling j by -1 (first) and 1
+    // (second)
+    numZeroViolations[0] = 0;
+    numZeroViolations[1] = 0;
+    for (const HighsSliceNonzero& nonz : getColumnVector(j)) {
+      denseColJ[nonz.index()] = nonz.value();
+      denseColJRows.push_back(nonz.index());
+      numZeroViolations[0] +=
+          !checkCoefficients(nonz.index(), -nonz.value(), 0.0);
+      numZeroViolations[1] +=
+          !checkCoefficients(nonz.index(), nonz.value(), 0.0);
+    }
+  };
+
   auto checkDomination = [&](HighsInt scalj, HighsInt j, HighsInt scalk,
-                             HighsInt k) {
+                             HighsInt k, HighsInt& numChecked) {
+    assert(j == scatteredColJ);
     // rule out domination from integers to continuous variables
     if (model->integrality_[j] == HighsVarType::kInteger &&
         model->integrality_[k] != HighsVarType::kInteger)
       return false;
 
     // check the signatures
-    uint32_t sjMinus = signatures[j].first;
-    uint32_t sjPlus = signatures[j].second;
+    uint64_t sjMinus = signatures[j].first;
+    uint64_t sjPlus = signatures[j].second;
     if (scalj == -1) std::swap(sjPlus, sjMinus);
 
-    uint32_t skMinus = signatures[k].first;
-    uint32_t skPlus = signatures[k].second;
+    uint64_t skMinus = signatures[k].first;
+    uint64_t skPlus = signatures[k].second;
     if (scalk == -1) std::swap(skPlus, skMinus);
 
     // the set of rows with a negative coefficient must be a superset of the
@@ -1002,66 +1072,66 @@ HPresolve::Result HPresolve::dominatedColumns(
     if (cj > ck + options->small_matrix_value) return false;
 
     // finally check the column vectors
-    for (const HighsSliceNonzero& nonz : getColumnVector(j)) {
+    ++numChecked;
+    HighsInt numViolations = numZeroViolations[scalj == 1];
+    for (const HighsSliceNonzero& nonz : getColumnVector(k)) {
       HighsInt row = nonz.index();
-      double aj = scalj * nonz.value();
-
-      HighsInt akPos = findNonzero(row, k);
-      double ak = scalk * (akPos == -1 ? 0.0 : Avalue[akPos]);
-
-      if (model->row_lower_[row] != -kHighsInf &&
-          model->row_upper_[row] != kHighsInf) {
-        // the row is an equality or ranged row, therefore the coefficients must
-        // be parallel, otherwise one of the inequalities given by the row rules
-        // out domination
-        if (std::abs(aj - ak) > options->small_matrix_value) return false;
-        continue;
-      }
+      double ak = scalk * nonz.value();
+      double aj = scalj * denseColJ[row];
 
-      // normalize row to a <= constraint
-      if (model->row_upper_[row] == kHighsInf) {
-        aj = -aj;
-        ak = -ak;
-      }
+      // the row is shared with j, so the violation that would result from a
+      // zero coefficient of k in this row is replaced by the actual check
+      if (aj != 0.0 && !checkCoefficients(row, aj, 0.0)) --numViolations;
 
-      // the coefficient of the dominating column needs to be smaller than or
-      // equal to the coefficient of the dominated column
-      if (aj > ak + options->small_matrix_value) return false;
+      if (!checkCoefficients(row, aj, ak)) return false;
     }
 
-    // check row only occurring in the column vector of k
-    for (const HighsSliceNonzero& nonz : getColumnVector(k)) {
-      HighsInt row = nonz.index();
-      double ak = scalk * nonz.value();
-
-      HighsInt ajPos = findNonzero(row, j);
-      // only rows in which aj does not occur are left to check
-      if (ajPos != -1) continue;
-      double aj = 0.0;
-
-      if (model->row_lower_[row] != -kHighsInf &&
-          model->row_upper_[row] != kHighsInf) {
-        // the row is an equality or ranged row, therefore the coefficients must
-        // be parallel, otherwise one of the inequalities given by the row rules
-        // out domination
-        if (std::abs(aj - ak) > options->small_matrix_value) return false;
-        continue;
-      }
+    return numViolations == 0;
+  };
 
-      // normalize row to a <= constraint
-      if (model->row_upper_[row] == kHighsInf) {
-        aj = -aj;
-        ak = -ak;
-      }
+  // when the row that is scanned for candidate columns is long, the checks are
+  // run in parallel as long as no reduction changed the problem. The flags
+  // store the result for scaling k by 1 (first bit) and -1 (second bit)
+  const bool checkInParallel = highs::parallel::num_threads() > 1;
+  constexpr HighsInt kMinCandidatesForParallelism = 256;
+  std::vector<uint8_t> candidateFlags;
+  HighsInt numChecked = 0;
+
+  auto checkCandidatesInParallel = [&](HighsInt scalj, HighsInt j) {
+    HighsInt numCandidates = rowpositions.size();
+    if (!checkInParallel || numCandidates < kMinCandidatesForParallelism)
+      return false;
 
-      // the coefficient of the dominating column needs to be smaller than or
-      // equal to the coefficient of the dominated column
-      if (aj > ak + options->small_matrix_value) return false;
-    }
+    candidateFlags.assign(numCandidates, 0);
+    auto threadNumChecked = makeHighsCombinable<HighsInt>([]() { return 0; });
+    highs::parallel::for_each(
+        0, numCandidates,
+        [&](HighsInt start, HighsInt end) {
+          HighsInt& numLocalChecked = threadNumChecked.local();
+          for (HighsInt i = start; i < end; ++i) {
+            HighsInt k = Acol[rowpositions[i]];
+            if (k == j || colDeleted[k]) continue;
+            if (checkDomination(scalj, j, 1, k, numLocalChecked))
+              candidateFlags[i] |= 1;
+            if (checkDomination(scalj, j, -1, k, numLocalChecked))
+              candidateFlags[i] |= 2;
+          }
+        },
+        32);
+    threadNumChecked.combine_each(
+        [&](HighsInt numLocalChecked) { numChecked += numLocalChecked; });
 
     return true;
   };
 
+  bool useCandidateFlags = false;
+  auto isDominated = [&](HighsInt candidate, HighsInt scalj, HighsInt j,
+                         HighsInt scalk, HighsInt k) {
+    if (useCandidateFlags)
+      return (candidateFlags[candidate] & (scalk == 1 ? 1 : 2)) != 0;
+    return checkDomination(scalj, j, scalk, k, numChecked);
+  };
+
   HighsInt numNz = Avalue.size();
   for (HighsInt i = 0; i < numNz; ++i) {
     if (Avalue[i] == 0) continue;
@@ -1092,6 +1162,7 @@ HPresolve::Result HPresolve::dominatedColumns(
       continue;
 
     HighsInt oldNumFixed = numFixedCols;
+    scatterColJ(j);
 
     HighsInt bestRowPlus = -1;
     HighsInt bestRowPlusLen = kHighsIInf;
@@ -1171,7 +1242,10 @@ HPresolve::Result HPresolve::dominatedColumns(
               model->row_lower_[bestRowMinus] != -kHighsInf &&
               model->row_upper_[bestRowMinus] != kHighsInf;
 
+          useCandidateFlags = checkCandidatesInParallel(-1, j);
+          HighsInt candidate = -1;
           for (const HighsSliceNonzero& nonz : getStoredRow()) {
+            ++candidate;
             HighsInt k = nonz.index();
             if (k == j || colDeleted[k]) continue;
 
@@ -1180,7 +1254,7 @@ HPresolve::Result HPresolve::dominatedColumns(
             if (-ajBestRowMinus <= -ak + options->small_matrix_value &&
                 (!isEqOrRangedRow ||
                  -ajBestRowMinus >= -ak - options->small_matrix_value) &&
-                checkDomination(-1, j, -1, k)) {
+                isDominated(candidate, -1, j, -1, k)) {
               // case (iii)  lb(x_j) = -inf, -x_j > -x_k: set x_k = ub(x_k)
               ++numFixedCols;
               fixColToLower(postsolve_stack, j);
@@ -1189,7 +1263,7 @@ HPresolve::Result HPresolve::dominatedColumns(
             } else if (-ajBestRowMinus <= ak + options->small_matrix_value &&
                        (!isEqOrRangedRow ||
                         -ajBestRowMinus >= ak - options->small_matrix_value) &&
-                       checkDomination(-1, j, 1, k)) {
+                       isDominated(candidate, -1, j, 1, k)) {
               // case (iv)  lb(x_j) = -inf, -x_j > x_k: set x_k = lb(x_k)
               ++numFixedCols;
               fixColToLower(postsolve_stack, j);
@@ -1211,7 +1285,10 @@ HPresolve::Result HPresolve::dominatedColumns(
           storeRow(bestRowPlus);
           bool isEqOrRangedRow = model->row_lower_[bestRowPlus] != -kHighsInf &&
                                  model->row_upper_[bestRowPlus] != kHighsInf;
+          useCandidateFlags = checkCandidatesInParallel(1, j);
+          HighsInt candidate = -1;
           for (const HighsSliceNonzero& nonz : getStoredRow()) {
+            ++candidate;
             HighsInt k = nonz.index();
             if (k == j || colDeleted[k]) continue;
 
@@ -1220,7 +1297,7 @@ HPresolve::Result HPresolve::dominatedColumns(
             if (ajBestRowPlus <= ak + options->small_matrix_value &&
                 (!isEqOrRangedRow ||
                  ajBestRowPlus >= ak - options->small_matrix_value) &&
-                checkDomination(1, j, 1, k)) {
+                isDominated(candidate, 1, j, 1, k)) {
               // case (i)  ub(x_j) = inf, x_j > x_k: set x_k = lb(x_k)
               ++numFixedCols;
               fixColToUpper(postsolve_stack, j);
@@ -1229,7 +1306,7 @@ HPresolve::Result HPresolve::dominatedColumns(
             } else if (ajBestRowPlus <= -ak + options->small_matrix_value &&
                        (!isEqOrRangedRow ||
                         ajBestRowPlus >= -ak - options->small_matrix_value) &&
-                       checkDomination(1, j, -1, k)) {
+                       isDominated(candidate, 1, j, -1, k)) {
               // case (ii)  ub(x_j) = inf, x_j > -x_k: set x_k = ub(x_k)
               ++numFixedCols;
               fixColToUpper(postsolve_stack, j);
@@ -1255,7 +1332,10 @@ HPresolve::Result HPresolve::dominatedColumns(
       storeRow(bestRowPlus);
       bool isEqOrRangedRow = model->row_lower_[bestRowPlus] != -kHighsInf &&
                              model->row_upper_[bestRowPlus] != kHighsInf;
+      useCandidateFlags = checkCandidatesInParallel(1, j);
+      HighsInt candidate = -1;
       for (const HighsSliceNonzero& nonz : getStoredRow()) {
+        ++candidate;
         HighsInt k = nonz.index();
         if (k == j || colDeleted[k]) continue;
 
@@ -1268,11 +1348,13 @@ HPresolve::Result HPresolve::dominatedColumns(
             ajBestRowPlus <= ak + options->small_matrix_value &&
             (!isEqOrRangedRow ||
              ajBestRowPlus >= ak - options->small_matrix_value) &&
-            checkDomination(1, j, 1, k)) {
+            isDominated(candidate, 1, j, 1, k)) {
           // case (i)  ub(x_j) = inf, x_j > x_k: set x_k = lb(x_k)
           ++numFixedCols;
           fixColToLower(postsolve_stack, k);
           HPRESOLVE_CHECKED_CALL(removeRowSingletons(postsolve_stack));
+          useCandidateFlags = false;
+          scatterColJ(j);
         } else if (model->col_upper_[k] != kHighsInf &&
                    (upperImplied ||
                     mipsolver->mipdata_->cliquetable.haveCommonClique(
@@ -1281,11 +1363,13 @@ HPresolve::Result HPresolve::dominatedColumns(
                    ajBestRowPlus <= -ak + options->small_matrix_value &&
                    (!isEqOrRangedRow ||
                     ajBestRowPlus >= -ak - options->small_matrix_value) &&
-                   checkDomination(1, j, -1, k)) {
+                   isDominated(candidate, 1, j, -1, k)) {
           // case (ii)  ub(x_j) = inf, x_j > -x_k: set x_k = ub(x_k)
           ++numFixedCols;
           fixColToUpper(postsolve_stack, k);
           HPRESOLVE_CHECKED_CALL(removeRowSingletons(postsolve_stack));
+          useCandidateFlags = false;
+          scatterColJ(j);
         }
       }
     }
@@ -1297,7 +1381,10 @@ HPresolve::Result HPresolve::dominatedColumns(
       bool isEqOrRangedRow = model->row_lower_[bestRowMinus] != -kHighsInf &&
                              model->row_upper_[bestRowMinus] != kHighsInf;
 
+      useCandidateFlags = checkCandidatesInParallel(-1, j);
+      HighsInt candidate = -1;
       for (const HighsSliceNonzero& nonz : getStoredRow()) {
+        ++candidate;
         HighsInt k = nonz.index();
         if (k == j || colDeleted[k]) continue;
 
@@ -1310,11 +1397,13 @@ HPresolve::Result HPresolve::dominatedColumns(
             -ajBestRowMinus <= -ak + options->small_matrix_value &&
             (!isEqOrRangedRow ||
              -ajBestRowMinus >= -ak - options->small_matrix_value) &&
-            checkDomination(-1, j, -1, k)) {
+            isDominated(candidate, -1, j, -1, k)) {
           // case (iii)  lb(x_j) = -inf, -x_j > -x_k: set x_k = ub(x_k)
           ++numFixedCols;
           fixColToUpper(postsolve_stack, k);
           HPRESOLVE_CHECKED_CALL(removeRowSingletons(postsolve_stack));
+          useCandidateFlags = false;
+          scatterColJ(j);
         } else if (model->col_lower_[k] != -kHighsInf &&
                    (lowerImplied ||
                     mipsolver->mipdata_->cliquetable.haveCommonClique(
@@ -1323,11 +1412,13 @@ HPresolve::Result HPresolve::dominatedColumns(
                    -ajBestRowMinus <= ak + options->small_matrix_value &&
                    (!isEqOrRangedRow ||
                     -ajBestRowMinus >= ak - options->small_matrix_value) &&
-                   checkDomination(-1, j, 1, k)) {
+                   isDominated(candidate, -1, j, 1, k)) {
           // case (iv)  lb(x_j) = -inf, -x_j > x_k: set x_k = lb(x_k)
           ++numFixedCols;
           fixColToLower(postsolve_stack, k);
           HPRESOLVE_CHECKED_CALL(removeRowSingletons(postsolve_stack));
+          useCandidateFlags = false;
+          scatterColJ(j);
         }
       }
     }
@@ -1336,9 +1427,12 @@ HPresolve::Result HPresolve::dominatedColumns(
       HPRESOLVE_CHECKED_CALL(removeDoubletonEquations(postsolve_stack));
   }
 
-  if (numFixedCols)
+  if (numFixedCols > 0)
     highsLogDev(options->log_options, HighsLogType::kInfo,
-                "Fixed %d dominated columns\n", numFixedCols);
+                "Dominated columns: %" HIGHSINT_FORMAT
+                " candidate pairs checked, %" HIGHSINT_FORMAT
+                " columns fixed\n",
+                numChecked, numFixedCols);
 
   return Result::kOk;
 }
@@ -1452,9 +1546,21 @@ HPresolve::Result HPresolve::runProbing(HighsPostsolveStack& postsolve_stack) {
         cliquetable.numNeighbourhoodQueries +
         std::max(mipsolver->submip ? HighsInt{0} : HighsInt{100000},
                  10 * numNonzeros());
+    const double probingTimeLimit =
+        timer->read(run_clock) + options->presolve_probing_time_limit;
     HighsInt numFail = 0;
-    for (const auto& binvar : binaries) {
-      HighsInt i = std::get<3>(binvar);
+
+    // with several threads, the implications of the binaries are computed
+    // in batches on copies of the global domain in parallel, and are then
+    // merged into the clique table and implications in the order below
+    const bool prefetchImplications = highs::parallel::num_threads() > 1;
+    const size_t prefetchBatchSize =
+        std::max(size_t{256}, size_t(model->num_col_ + model->num_row_) / 32);
+    size_t prefetchEnd = 0;
+    std::vector<HighsInt> prefetchCols;
+
+    for (size_t k = 0; k != binaries.size(); ++k) {
+      HighsInt i = std::get<3>(binaries[k]);
 
       if (cliquetable.getSubstitution(i) != nullptr) continue;
 
@@ -1488,6 +1594,24 @@ HPresolve::Result HPresolve::runProbing(HighsPostsolveStack& postsolve_stack) {
 
         if (probingContingent - numProbed < 0) break;
 
+        if (timer->read(run_clock) >= probingTimeLimit ||
+            numProbed - oldNumProbed >= options->presolve_probing_work_limit)
+          break;
+
+        if (prefetchImplications && k >= prefetchEnd) {
+          prefetchEnd = std::min(binaries.size(), k + prefetchBatchSize);
+          prefetchCols.clear();
+          for (size_t l = k; l != prefetchEnd; ++l) {
+            HighsInt col = std::get<3>(binaries[l]);
+            if (domain.isBinary(col) &&
+                cliquetable.getSubstitution(col) == nullptr &&
+                !implications.implicationsCached(col, 0) &&
+                !implications.implicationsCached(col, 1))
+              prefetchCols.push_back(col);
+          }
+          implications.prefetchImplications(prefetchCols);
+        }
+
         HighsInt numBoundChgs = 0;
         HighsInt numNewCliques = -cliquetable.numCliques();
         if (!implications.runProbing(i, numBoundChgs)) continue;
@@ -1525,11 +1649,13 @@ HPresolve::Result HPresolve::runProbing(HighsPostsolveStack& postsolve_stack) {
         // "\n", nprobed,
         //       cliquetable.numCliques());
         if (domain.infeasible()) {
+          implications.clearPrefetchedImplications();
           return Result::kPrimalInfeasible;
         }
       }
     }
 
+    implications.clearPrefetchedImplications();
     cliquetable.cleanupFixed(domain);
 
     if (!firstCall) cliquetable.extractCliques(*mipsolver, false);
@@ -1642,6 +1768,7 @@ void HPresolve::addToMatrix(const HighsInt row, const HighsInt col,
       impliedRowBounds.remove(row, col, Avalue[pos]);
       impliedDualRowBounds.remove(col, row, Avalue[pos]);
       Avalue[pos] = sum;
+      ++numNonzerosTouched;
       // value not zero, add new contributions and locks with opposite sign
       impliedRowBounds.add(row, col, Avalue[pos]);
       impliedDualRowBounds.add(col, row, Avalue[pos]);
@@ -4226,7 +4353,8 @@ HPresolve::Result HPresolve::presolve(HighsPostsolveStack& postsolve_stack) {
         report();
       }
 
-      HPRESOLVE_CHECKED_CALL(fastPresolveLoop(postsolve_stack));
+      HPRESOLVE_LOGGED_CALL(kPresolvePassFastLoop,
+                            fastPresolveLoop(postsolve_stack));
 
       storeCurrentProblemSize();
 
@@ -4239,13 +4367,15 @@ HPresolve::Result HPresolve::presolve(HighsPostsolveStack& postsolve_stack) {
       }
 
       if (analysis_.allow_rule_[kPresolveRuleAggregator])
-        HPRESOLVE_CHECKED_CALL(aggregator(postsolve_stack));
+        HPRESOLVE_LOGGED_CALL(kPresolvePassAggregator,
+                              aggregator(postsolve_stack));
 
       if (problemSizeReduction() > 0.05) continue;
 
       if (trySparsify) {
         HighsInt numNz = numNonzeros();
-        HPRESOLVE_CHECKED_CALL(sparsify(postsolve_stack));
+        HPRESOLVE_LOGGED_CALL(kPresolvePassSparsify,
+                              sparsify(postsolve_stack));
         double nzReduction = 100.0 * (1.0 - (numNonzeros() / (double)numNz));
 
         if (nzReduction > 0) {
@@ -4257,7 +4387,8 @@ HPresolve::Result HPresolve::presolve(HighsPostsolveStack& postsolve_stack) {
           // fastPresolveLoop(postsolve_stack);
           //
           // but
-          HPRESOLVE_CHECKED_CALL(fastPresolveLoop(postsolve_stack));
+          HPRESOLVE_LOGGED_CALL(kPresolvePassFastLoop,
+                                fastPresolveLoop(postsolve_stack));
         }
         trySparsify = false;
       }
@@ -4274,41 +4405,50 @@ HPresolve::Result HPresolve::presolve(HighsPostsolveStack& postsolve_stack) {
                     model->a_matrix_.start_);
         }
         storeCurrentProblemSize();
-        HPRESOLVE_CHECKED_CALL(detectParallelRowsAndCols(postsolve_stack));
+        HPRESOLVE_LOGGED_CALL(kPresolvePassParallelRowsAndCols,
+                              detectParallelRowsAndCols(postsolve_stack));
         ++numParallelRowColCalls;
         if (problemSizeReduction() > 0.05) continue;
       }
 
-      HPRESOLVE_CHECKED_CALL(fastPresolveLoop(postsolve_stack));
+      HPRESOLVE_LOGGED_CALL(kPresolvePassFastLoop,
+                            fastPresolveLoop(postsolve_stack));
 
       if (mipsolver != nullptr) {
+        startPresolvePass(kPresolvePassStrengthenInequalities);
         HighsInt numStrenghtened = strengthenInequalities();
+        stopPresolvePass(kPresolvePassStrengthenInequalities);
         if (numStrenghtened > 0)
           highsLogDev(options->log_options, HighsLogType::kInfo,
                       "Strengthened %" HIGHSINT_FORMAT " coefficients\n",
                       numStrenghtened);
       }
 
-      HPRESOLVE_CHECKED_CALL(fastPresolveLoop(postsolve_stack));
+      HPRESOLVE_LOGGED_CALL(kPresolvePassFastLoop,
+                            fastPresolveLoop(postsolve_stack));
 
       if (mipsolver != nullptr && numCliquesBeforeProbing == -1) {
         numCliquesBeforeProbing = mipsolver->mipdata_->cliquetable.numCliques();
         storeCurrentProblemSize();
-        HPRESOLVE_CHECKED_CALL(dominatedColumns(postsolve_stack));
+        HPRESOLVE_LOGGED_CALL(kPresolvePassDominatedCols,
+                              dominatedColumns(postsolve_stack));
         if (problemSizeReduction() > 0.0)
-          HPRESOLVE_CHECKED_CALL(fastPresolveLoop(postsolve_stack));
+          HPRESOLVE_LOGGED_CALL(kPresolvePassFastLoop,
+                                fastPresolveLoop(postsolve_stack));
         if (problemSizeReduction() > 0.05) continue;
       }
 
       if (tryProbing) {
         detectImpliedIntegers();
         storeCurrentProblemSize();
-        HPRESOLVE_CHECKED_CALL(runProbing(postsolve_stack));
+        HPRESOLVE_LOGGED_CALL(kPresolvePassProbing,
+                              runProbing(postsolve_stack));
         tryProbing = probingContingent > numProbed &&
                      (problemSizeReduction() > 1.0 || probingEarlyAbort);
         trySparsify = true;
         if (problemSizeReduction() > 0.05 || tryProbing) continue;
-        HPRESOLVE_CHECKED_CALL(fastPresolveLoop(postsolve_stack));
+        HPRESOLVE_LOGGED_CALL(kPresolvePassFastLoop,
+                              fastPresolveLoop(postsolve_stack));
       }
 
       if (!dependentEquationsCalled) {
@@ -4323,11 +4463,13 @@ HPresolve::Result HPresolve::presolve(HighsPostsolveStack& postsolve_stack) {
         }
         storeCurrentProblemSize();
         if (analysis_.allow_rule_[kPresolveRuleDependentEquations]) {
-          HPRESOLVE_CHECKED_CALL(removeDependentEquations(postsolve_stack));
+          HPRESOLVE_LOGGED_CALL(kPresolvePassDependentEquations,
+                                removeDependentEquations(postsolve_stack));
           dependentEquationsCalled = true;
         }
         if (analysis_.allow_rule_[kPresolveRuleDependentFreeCols])
-          HPRESOLVE_CHECKED_CALL(removeDependentFreeCols(postsolve_stack));
+          HPRESOLVE_LOGGED_CALL(kPresolvePassDependentFreeCols,
+                                removeDependentFreeCols(postsolve_stack));
         if (problemSizeReduction() > 0.05) continue;
       }
 
@@ -4337,9 +4479,11 @@ HPresolve::Result HPresolve::presolve(HighsPostsolveStack& postsolve_stack) {
           !domcolAfterProbingCalled) {
         domcolAfterProbingCalled = true;
         storeCurrentProblemSize();
-        HPRESOLVE_CHECKED_CALL(dominatedColumns(postsolve_stack));
+        HPRESOLVE_LOGGED_CALL(kPresolvePassDominatedCols,
+                              dominatedColumns(postsolve_stack));
         if (problemSizeReduction() > 0.0)
-          HPRESOLVE_CHECKED_CALL(fastPresolveLoop(postsolve_stack));
+          HPRESOLVE_LOGGED_CALL(kPresolvePassFastLoop,
+                                fastPresolveLoop(postsolve_stack));
         if (problemSizeReduction() > 0.05) continue;
       }
 
@@ -4451,7 +4595,17 @@ HighsModelStatus HPresolve::run(HighsPostsolveStack& postsolve_stack) {
                    postsolve_stack.numReductions(), reductionLimit);
     }
   };
-  switch (presolve(postsolve_stack)) {
+  const Result result = presolve(postsolve_stack);
+  // the pass statistics are reported for every outcome of presolve, since
+  // they are of most interest when presolve finds the model to be
+  // infeasible or unbounded
+  analysis_.reportPresolvePassLog();
+  if (!options->presolve_log_file.empty() &&
+      !analysis_.writePresolveLogJson(options->presolve_log_file))
+    highsLogUser(options->log_options, HighsLogType::kWarning,
+                 "Unable to write presolve log to file \"%s\"\n",
+                 options->presolve_log_file.c_str());
+  switch (result) {
     case Result::kStopped:
     case Result::kOk:
       break;
@@ -6439,9 +6593,18 @@ HPresolve::Result HPresolve::sparsify(HighsPostsolveStack& postsolve_stack) {
 
   const double minNonzeroVal = std::sqrt(primal_feastol);
 
+  const double sparsifyTimeLimit =
+      timer->read(run_clock) + options->presolve_sparsify_time_limit;
+
+  HighsInt numEquationsUsed = 0;
+
   for (const auto& eq : equations) tmpEquations.emplace_back(eq.second);
   for (HighsInt eqrow : tmpEquations) {
     if (rowDeleted[eqrow]) continue;
+    if (timer->read(run_clock) >= sparsifyTimeLimit ||
+        numEquationsUsed >= options->presolve_sparsify_work_limit)
+      break;
+    ++numEquationsUsed;
 
     assert(!rowDeleted[eqrow]);
     assert(model->row_lower_[eqrow] == model->row_upper_[eqrow]);
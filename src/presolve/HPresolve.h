@@ -126,6 +126,9 @@ class HPresolve {
   HighsInt numDeletedRows;
   HighsInt numDeletedCols;
 
+  // counter for number of nonzeros that are added, changed or removed
+  int64_t numNonzerosTouched;
+
   // store old problem sizes to compute percentage reductions in
   // presolve loop
   HighsInt oldNumCol;
@@ -286,6 +289,16 @@ class HPresolve {
 
   HighsInt numNonzeros() const { return int(Avalue.size() - freeslots.size()); }
 
+  void startPresolvePass(const HighsInt pass_type) {
+    analysis_.startPresolvePassLog(pass_type, timer->read(run_clock),
+                                   numNonzeros(), numNonzerosTouched);
+  }
+
+  void stopPresolvePass(const HighsInt pass_type) {
+    analysis_.stopPresolvePassLog(pass_type, timer->read(run_clock),
+                                  numNonzeros(), numNonzerosTouched);
+  }
+
   void shrinkProblem(HighsPostsolveStack& postsolve_stack);
 
   void addToMatrix(const HighsInt row, const HighsInt col, const double val);
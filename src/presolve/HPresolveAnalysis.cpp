@@ -53,10 +53,14 @@ void HPresolveAnalysis::setup(const HighsLp* model_,
       bit *= 2;
     }
   }
-  // Allow logging if option is set and model is not a MIP
-  allow_logging_ = options_->presolve_rule_logging && !model_->isMip();
+  // Allow logging if option is set, or the presolve log is written to
+  // a file, and model is not a MIP
+  allow_logging_ = (options_->presolve_rule_logging ||
+                    !options_->presolve_log_file.empty()) &&
+                   !model_->isMip();
   logging_on_ = allow_logging_;
   log_rule_type_ = kPresolveRuleIllegal;
+  log_pass_type_ = kPresolvePassIllegal;
   resetNumDeleted();
   presolve_log_.clear();
   original_num_col_ = model->num_col_;
@@ -70,6 +74,16 @@ void HighsPresolveLog::clear() {
     this->rule[rule_type].col_removed = 0;
     this->rule[rule_type].row_removed = 0;
   }
+  this->pass.resize(kPresolvePassCount);
+  for (HighsInt pass_type = 0; pass_type < kPresolvePassCount; pass_type++) {
+    this->pass[pass_type].call = 0;
+    this->pass[pass_type].success = 0;
+    this->pass[pass_type].col_removed = 0;
+    this->pass[pass_type].row_removed = 0;
+    this->pass[pass_type].nz_removed = 0;
+    this->pass[pass_type].nz_touched = 0;
+    this->pass[pass_type].time = 0;
+  }
 }
 
 void HPresolveAnalysis::resetNumDeleted() {
@@ -226,3 +240,116 @@ bool HPresolveAnalysis::analysePresolveRuleLog(const bool report) {
   }
   return true;
 }
+
+void HPresolveAnalysis::startPresolvePassLog(const HighsInt pass_type,
+                                             const double time,
+                                             const HighsInt num_nz,
+                                             const int64_t num_nz_touched) {
+  assert(pass_type >= kPresolvePassMin && pass_type <= kPresolvePassMax);
+  // Check that stop has been called since the last start
+  assert(log_pass_type_ == kPresolvePassIllegal);
+  log_pass_type_ = pass_type;
+  pass_start_time_ = time;
+  // Deleted rows and columns are counted relative to the current
+  // dimensions since the problem may be shrunk within a pass
+  pass_num_row0_ = model->num_row_ - *numDeletedRows;
+  pass_num_col0_ = model->num_col_ - *numDeletedCols;
+  pass_num_nz0_ = num_nz;
+  pass_num_nz_touched0_ = num_nz_touched;
+  presolve_log_.pass[pass_type].call++;
+}
+
+void HPresolveAnalysis::stopPresolvePassLog(const HighsInt pass_type,
+                                            const double time,
+                                            const HighsInt num_nz,
+                                            const int64_t num_nz_touched) {
+  assert(pass_type == log_pass_type_);
+  HighsPresolvePassLog& pass_log = presolve_log_.pass[pass_type];
+  const HighsInt num_removed_row =
+      pass_num_row0_ - (model->num_row_ - *numDeletedRows);
+  const HighsInt num_removed_col =
+      pass_num_col0_ - (model->num_col_ - *numDeletedCols);
+  const HighsInt num_removed_nz = pass_num_nz0_ - num_nz;
+  pass_log.row_removed += num_removed_row;
+  pass_log.col_removed += num_removed_col;
+  pass_log.nz_removed += num_removed_nz;
+  pass_log.nz_touched += num_nz_touched - pass_num_nz_touched0_;
+  pass_log.time += time - pass_start_time_;
+  if (num_removed_row || num_removed_col || num_removed_nz) pass_log.success++;
+  log_pass_type_ = kPresolvePassIllegal;
+}
+
+void HPresolveAnalysis::reportPresolvePassLog() const {
+  const HighsLogOptions& log_options = options->log_options;
+  HighsInt num_call = 0;
+  for (HighsInt pass_type = kPresolvePassMin; pass_type < kPresolvePassCount;
+       pass_type++)
+    num_call += presolve_log_.pass[pass_type].call;
+  if (!num_call) return;
+  const std::string rule =
+      "---------------------------------------------------------------------"
+      "-----------------------";
+  highsLogDev(log_options, HighsLogType::kInfo, "%s\n", rule.c_str());
+  highsLogDev(log_options, HighsLogType::kInfo,
+              "%-25s     Calls   Success      Rows      Cols  Nonzeros  "
+              "   Touched      Time\n",
+              "Presolve pass");
+  highsLogDev(log_options, HighsLogType::kInfo, "%s\n", rule.c_str());
+  for (HighsInt pass_type = kPresolvePassMin; pass_type < kPresolvePassCount;
+       pass_type++) {
+    const HighsPresolvePassLog& pass_log = presolve_log_.pass[pass_type];
+    if (!pass_log.call) continue;
+    highsLogDev(log_options, HighsLogType::kInfo,
+                "%-25s %9d %9d %9d %9d %9d %11" PRId64 " %9.3f\n",
+                utilPresolvePassTypeToString(pass_type).c_str(),
+                (int)pass_log.call, (int)pass_log.success,
+                (int)pass_log.row_removed, (int)pass_log.col_removed,
+                (int)pass_log.nz_removed, pass_log.nz_touched, pass_log.time);
+  }
+  highsLogDev(log_options, HighsLogType::kInfo, "%s\n", rule.c_str());
+}
+
+bool HPresolveAnalysis::writePresolveLogJson(
+    const std::string& filename) const {
+  FILE* file = fopen(filename.c_str(), "w");
+  if (file == nullptr) return false;
+  fprintf(file, "{\n  \"passes\": [");
+  bool first = true;
+  for (HighsInt pass_type = kPresolvePassMin; pass_type < kPresolvePassCount;
+       pass_type++) {
+    const HighsPresolvePassLog& pass_log = presolve_log_.pass[pass_type];
+    fprintf(file,
+            "%s\n    {\"pass\": \"%s\", \"calls\": %d, \"success\": %d, "
+            "\"rows_removed\": %d, \"cols_removed\": %d, "
+            "\"nonzeros_removed\": %d, \"nonzeros_touched\": %" PRId64
+            ", \"time\": %.6f}",
+            first ? "" : ",",
+            utilPresolvePassTypeToString(pass_type).c_str(),
+            (int)pass_log.call, (int)pass_log.success,
+            (int)pass_log.row_removed, (int)pass_log.col_removed,
+            (int)pass_log.nz_removed, pass_log.nz_touched, pass_log.time);
+    first = false;
+  }
+  fprintf(file, "\n  ]");
+  // The rule log is only maintained when rule logging is allowed
+  if (allow_logging_) {
+    fprintf(file, ",\n  \"rules\": [");
+    first = true;
+    for (HighsInt rule_type = kPresolveRuleMin; rule_type < kPresolveRuleCount;
+         rule_type++) {
+      const HighsPresolveRuleLog& rule_log = presolve_log_.rule[rule_type];
+      fprintf(file,
+              "%s\n    {\"rule\": \"%s\", \"calls\": %d, "
+              "\"rows_removed\": %d, \"cols_removed\": %d}",
+              first ? "" : ",",
+              utilPresolveRuleTypeToString(rule_type).c_str(),
+              (int)rule_log.call, (int)rule_log.row_removed,
+              (int)rule_log.col_removed);
+      first = false;
+    }
+    fprintf(file, "\n  ]");
+  }
+  fprintf(file, "\n}\n");
+  fclose(file);
+  return true;
+}
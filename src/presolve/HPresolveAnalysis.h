@@ -36,6 +36,14 @@ class HPresolveAnalysis {
   HighsInt num_deleted_cols0_;
   HighsPresolveLog presolve_log_;
 
+  // for recording the statistics of presolve passes
+  int log_pass_type_;
+  double pass_start_time_;
+  HighsInt pass_num_row0_;
+  HighsInt pass_num_col0_;
+  HighsInt pass_num_nz0_;
+  int64_t pass_num_nz_touched0_;
+
   // for LP presolve
   //
   // Transform options->presolve_rule_off into logical settings in
@@ -48,6 +56,14 @@ class HPresolveAnalysis {
   void startPresolveRuleLog(const HighsInt rule_type);
   void stopPresolveRuleLog(const HighsInt rule_type);
   bool analysePresolveRuleLog(const bool report = false);
+
+  void startPresolvePassLog(const HighsInt pass_type, const double time,
+                            const HighsInt num_nz,
+                            const int64_t num_nz_touched);
+  void stopPresolvePassLog(const HighsInt pass_type, const double time,
+                           const HighsInt num_nz, const int64_t num_nz_touched);
+  void reportPresolvePassLog() const;
+  bool writePresolveLogJson(const std::string& filename) const;
   friend class HPresolve;
 };
 
@@ -550,6 +550,38 @@ class HighsPostsolveStack {
     return reducedSolution;
   }
 
+  /// compute for each column of the reduced problem the mapping
+  /// origCol = scale * col + constant that results from all linear transforms
+  /// applied so far. Columns that are not linearly transformable, e.g. due to
+  /// merged duplicate columns, get a scale of zero
+  void getReducedColTransforms(std::vector<double>& colScale,
+                               std::vector<double>& colConstant) {
+    colScale.assign(origNumCol, 1.0);
+    colConstant.assign(origNumCol, 0.0);
+
+    for (const std::pair<ReductionType, size_t>& primalColTransformation :
+         reductions) {
+      if (primalColTransformation.first != ReductionType::kLinearTransform)
+        continue;
+      reductionValues.setPosition(primalColTransformation.second);
+      LinearTransform linearTransform;
+      reductionValues.pop(linearTransform);
+      colConstant[linearTransform.col] +=
+          colScale[linearTransform.col] * linearTransform.constant;
+      colScale[linearTransform.col] *= linearTransform.scale;
+    }
+
+    size_t reducedNumCol = origColIndex.size();
+    for (size_t i = 0; i < reducedNumCol; ++i) {
+      HighsInt origCol = origColIndex[i];
+      colScale[i] = linearlyTransformable[origCol] ? colScale[origCol] : 0.0;
+      colConstant[i] = colConstant[origCol];
+    }
+
+    colScale.resize(reducedNumCol);
+    colConstant.resize(reducedNumCol);
+  }
+
   bool isColLinearlyTransformable(HighsInt col) const {
     return (linearlyTransformable[col] != 0);
   }
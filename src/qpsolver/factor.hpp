@@ -1,7 +1,9 @@
 #ifndef __SRC_LIB_NEWFACTOR_HPP__
 #define __SRC_LIB_NEWFACTOR_HPP__
 
+#include <algorithm>
 #include <cassert>
+#include <cstdint>
 #include <vector>
 
 #include "matrix.hpp"
@@ -11,7 +13,33 @@
 using std::min;
 
 class CholeskyFactor {
+  // The unit tests compare the sparse rows with a dense factor
+  friend class CholeskyFactorTest;
+
  private:
+  // A row of the upper triangular factor L with its nonzeros sorted by
+  // column. The diagonal entry is always stored, so that it is the first
+  // entry of the row.
+  struct SparseRow {
+    std::vector<HighsInt> index;
+    std::vector<double> value;
+
+    void push(HighsInt idx, double val) {
+      index.push_back(idx);
+      value.push_back(val);
+    }
+
+    void clear() {
+      index.clear();
+      value.clear();
+    }
+
+    void swap(SparseRow& other) {
+      index.swap(other.index);
+      value.swap(other.value);
+    }
+  };
+
   bool uptodate = false;
   HighsInt numberofreduces = 0;
 
@@ -19,48 +47,128 @@ class CholeskyFactor {
 
   Basis& basis;
 
+  // The factor is stored by sparse rows, so that its memory and the cost of
+  // the updates scale with the number of nonzeros of the factor rather than
+  // with the square of the dimension of the null space
   HighsInt current_k = 0;
-  HighsInt current_k_max;
-  std::vector<double> L;
+  std::vector<SparseRow> L;
 
   bool has_negative_eigenvalue = false;
-  std::vector<double> a;
-
-  void resize(HighsInt new_k_max) {
-    std::vector<double> L_old = L;
-    L.clear();
-    L.resize((new_k_max) * (new_k_max));
-    const HighsInt l_size = L.size();
-    // Driven by #958, changes made in following lines to avoid array
-    // bound error when new_k_max < current_k_max
-    HighsInt min_k_max = min(new_k_max, current_k_max);
-    for (HighsInt i = 0; i < min_k_max; i++) {
-      for (HighsInt j = 0; j < min_k_max; j++) {
-	assert(i * (new_k_max) + j < l_size);
-        L[i * (new_k_max) + j] = L_old[i * current_k_max + j];
+
+  SparseRow buffer_row_i;
+  SparseRow buffer_row_j;
+  std::vector<double> work_value;
+  std::vector<uint8_t> work_mark;
+  std::vector<HighsInt> work_pattern;
+
+  double entry(HighsInt row, HighsInt col) const {
+    const SparseRow& r = L[row];
+    auto it = std::lower_bound(r.index.begin(), r.index.end(), col);
+    if (it == r.index.end() || *it != col) return 0.0;
+    return r.value[it - r.index.begin()];
+  }
+
+  // adds alpha times the entries of src in columns >= mincol to row target
+  void addRow(HighsInt target, double alpha, const SparseRow& src,
+              HighsInt mincol) {
+    SparseRow& row = L[target];
+    SparseRow& result = buffer_row_i;
+    result.clear();
+    size_t a = 0;
+    size_t b = std::lower_bound(src.index.begin(), src.index.end(), mincol) -
+               src.index.begin();
+    while (a < row.index.size() || b < src.index.size()) {
+      if (b == src.index.size() ||
+          (a < row.index.size() && row.index[a] < src.index[b])) {
+        result.push(row.index[a], row.value[a]);
+        a++;
+      } else if (a == row.index.size() || src.index[b] < row.index[a]) {
+        result.push(src.index[b], alpha * src.value[b]);
+        b++;
+      } else {
+        result.push(row.index[a], row.value[a] + alpha * src.value[b]);
+        a++;
+        b++;
       }
     }
-    current_k_max = new_k_max;
+    row.swap(result);
+  }
+
+  // Replaces row i by cos_ * row i - sin_ * row j and row j by
+  // sin_ * row i + cos_ * row j, where entry (j, col) becomes zero and is
+  // removed. The diagonal entries of the rows i and j are in columns i and j.
+  void rotateRows(HighsInt i, HighsInt j, double cos_, double sin_,
+                  HighsInt col) {
+    SparseRow& row_i = L[i];
+    SparseRow& row_j = L[j];
+    SparseRow& new_i = buffer_row_i;
+    SparseRow& new_j = buffer_row_j;
+    new_i.clear();
+    new_j.clear();
+    size_t a = 0;
+    size_t b = 0;
+    while (a < row_i.index.size() || b < row_j.index.size()) {
+      HighsInt idx;
+      if (b == row_j.index.size())
+        idx = row_i.index[a];
+      else if (a == row_i.index.size())
+        idx = row_j.index[b];
+      else
+        idx = min(row_i.index[a], row_j.index[b]);
+      double a_ik = 0.0;
+      double a_jk = 0.0;
+      if (a < row_i.index.size() && row_i.index[a] == idx)
+        a_ik = row_i.value[a++];
+      if (b < row_j.index.size() && row_j.index[b] == idx)
+        a_jk = row_j.value[b++];
+
+      double val_i = cos_ * a_ik - sin_ * a_jk;
+      double val_j = sin_ * a_ik + cos_ * a_jk;
+      if (val_i != 0.0 || idx == i) new_i.push(idx, val_i);
+      if ((val_j != 0.0 || idx == j) && idx != col) new_j.push(idx, val_j);
+    }
+    row_i.swap(new_i);
+    row_j.swap(new_j);
+  }
+
+  // applies a Givens rotation to rows i and j that eliminates entry (j, i)
+  // given the values m_ii and m_ji of entries (i, i) and (j, i)
+  void eliminate(HighsInt i, HighsInt j, double m_ii, double m_ji) {
+    if (m_ji == 0.0) {
+      return;
+    }
+    double z = sqrt(m_ii * m_ii + m_ji * m_ji);
+    double cos_, sin_;
+    if (z == 0) {
+      cos_ = 1.0;
+      sin_ = 0.0;
+    } else {
+      cos_ = m_ii / z;
+      sin_ = -m_ji / z;
+    }
+    rotateRows(i, j, cos_, sin_, i);
+  }
+
+  // removes the last row and column of the factor
+  void removeLast() {
+    current_k--;
+    L.resize(current_k);
+    for (SparseRow& row : L) {
+      if (row.index.back() != current_k) continue;
+      row.index.pop_back();
+      row.value.pop_back();
+    }
   }
 
  public:
   CholeskyFactor(Runtime& rt, Basis& bas) : runtime(rt), basis(bas) {
     uptodate = false;
-    current_k_max =
-        max(min((HighsInt)ceil(rt.instance.num_var / 16.0), (HighsInt)1000),
-            basis.getnuminactive());
-    L.resize(current_k_max * current_k_max);
   }
 
-
   void recompute() {
-    std::vector<std::vector<double>> orig;
     HighsInt dim_ns = basis.getinactive().size();
     numberofreduces = 0;
 
-    orig.assign(dim_ns, std::vector<double>(dim_ns, 0.0));
-    resize(dim_ns);
-
     Matrix temp(dim_ns, 0);
 
     QpVector buffer_Qcol(runtime.instance.num_var);
@@ -70,34 +178,43 @@ class CholeskyFactor {
       basis.Ztprod(buffer_Qcol, buffer_ZtQi);
       temp.append(buffer_ZtQi);
     }
+
+    // row i of L starts out as the upper triangular part of row i of Z'QZ
+    L.assign(dim_ns, SparseRow());
+    for (HighsInt i = 0; i < dim_ns; i++) L[i].push(i, 0.0);
     MatrixBase& temp_t = temp.t();
     for (HighsInt i = 0; i < dim_ns; i++) {
       basis.Ztprod(temp_t.extractcol(i, buffer_Qcol), buffer_ZtQi);
       for (HighsInt j = 0; j < buffer_ZtQi.num_nz; j++) {
-        orig[i][buffer_ZtQi.index[j]] = buffer_ZtQi.value[buffer_ZtQi.index[j]];
+        HighsInt row = buffer_ZtQi.index[j];
+        double value = buffer_ZtQi.value[row];
+        if (row == i)
+          L[i].value[0] = value;
+        else if (row < i && value != 0.0)
+          L[row].push(i, value);
       }
     }
 
-    for (size_t col = 0; col < orig.size(); col++) {
-      for (size_t row = 0; row <= col; row++) {
-        double sum = 0;
-        if (row == col) {
-          for (size_t k = 0; k < row; k++)
-            sum += L[k * current_k_max + row] * L[k * current_k_max + row];
-          L[row * current_k_max + row] = sqrt(orig[row][row] - sum);
-        } else {
-          for (size_t k = 0; k < row; k++)
-            sum += (L[k * current_k_max + col] * L[k * current_k_max + row]);
-          L[row * current_k_max + col] =
-              (orig[col][row] - sum) / L[row * current_k_max + row];
-        }
+    // right looking Cholesky factorization, where a row below the pivot is
+    // only updated if the pivot row has a nonzero in its column
+    for (HighsInt row = 0; row < dim_ns; row++) {
+      SparseRow& pivotrow = L[row];
+      double pivot = sqrt(pivotrow.value[0]);
+      pivotrow.value[0] = pivot;
+      for (size_t k = 1; k < pivotrow.index.size(); k++)
+        pivotrow.value[k] /= pivot;
+
+      for (size_t k = 1; k < pivotrow.index.size(); k++) {
+        HighsInt col = pivotrow.index[k];
+        addRow(col, -pivotrow.value[k], pivotrow, col);
       }
     }
     current_k = dim_ns;
     uptodate = true;
   }
 
-  QpSolverStatus expand(const QpVector& yp, QpVector& gyp, QpVector& l, QpVector& m) {
+  QpSolverStatus expand(const QpVector& yp, QpVector& gyp, QpVector& l,
+                        QpVector& m) {
     if (!uptodate) {
       return QpSolverStatus::OK;
     }
@@ -105,73 +222,22 @@ class CholeskyFactor {
     l.resparsify();
     double lambda = mu - l.norm2();
     if (lambda > 0.0) {
-      if (current_k_max <= current_k + 1) {
-        resize(current_k_max * 2);
+      for (HighsInt k = 0; k < l.num_nz; k++) {
+        HighsInt i = l.index[k];
+        if (i < current_k && l.value[i] != 0.0)
+          L[i].push(current_k, l.value[i]);
       }
-
-      for (HighsInt i = 0; i < current_k; i++) {
-        L[i * current_k_max + current_k] = l.value[i];
-      }
-      L[current_k * current_k_max + current_k] = sqrt(lambda);
+      L.emplace_back();
+      L[current_k].push(current_k, sqrt(lambda));
 
       current_k++;
     } else {
       return QpSolverStatus::NOTPOSITIVDEFINITE;
-
-      //     |LL' 0|
-      // M = |0'  0| + bb' -aa'
-      // a = (k * m, alpha), b = (k * m, beta)
-      // b*b -a*a = mu
-      // k(b-a) = 1
-      // b + a = k*mu
-  // Commented out unreachable code
-      //      const double tolerance = 0.001;
-      //
-      //      double beta = max(tolerance, sqrt(m.norm2() / L[0] + fabs(mu)));
-      //      double k = 1 / (beta + sqrt(beta * beta - mu));
-      //      double alpha = k * mu - beta;
-      //
-      //      printf("k = %d, alpha = %lf, beta = %lf, k = %lf\n", (int)current_k, alpha,
-      //             beta, k);
-      //
-      //      a.clear();
-      //      a.resize(current_k + 1);
-      //      for (HighsInt i = 0; i < current_k; i++) {
-      //        a[i] = k * m.value[i];
-      //      }
-      //      a[current_k] = alpha;
-      //
-      //      std::vector<double> b(current_k + 1);
-      //      for (HighsInt i = 0; i < current_k; i++) {
-      //        b[i] = k * m.value[i];
-      //      }
-      //      b[current_k] = beta;
-      //
-      //      if (current_k_max <= current_k + 1) {
-      //        resize(current_k_max * 2);
-      //      }
-      //
-      //      // append b to the left of L
-      //      for (HighsInt row = current_k; row > 0; row--) {
-      //        // move row one position down
-      //        for (HighsInt i = 0; i < current_k; i++) {
-      //          L[row * current_k_max + i] = L[(row - 1) * current_k_max + i];
-      //        }
-      //      }
-      //      for (HighsInt i = 0; i < current_k + 1; i++) {
-      //        L[i] = b[i];
-      //      }
-      //
-      //      // re-triangulize
-      //      for (HighsInt i = 0; i < current_k + 1; i++) {
-      //        eliminate(L, i, i + 1, current_k_max, current_k + 1);
-      //      }
-      //
-      //      current_k = current_k + 1;
     }
     return QpSolverStatus::OK;
   }
 
+  // solve L' y = v
   void solveL(QpVector& rhs) {
     if (!uptodate) {
       recompute();
@@ -182,23 +248,25 @@ class CholeskyFactor {
       return;
     }
 
+    // row r of L is column r of L', so the solve proceeds column wise
     for (HighsInt r = 0; r < rhs.dim; r++) {
-      for (HighsInt j = 0; j < r; j++) {
-        rhs.value[r] -= rhs.value[j] * L[j * current_k_max + r];
-      }
-
-      rhs.value[r] /= L[r * current_k_max + r];
+      const SparseRow& row = L[r];
+      rhs.value[r] /= row.value[0];
+      double x = rhs.value[r];
+      if (x == 0.0) continue;
+      for (size_t k = 1; k < row.index.size(); k++)
+        rhs.value[row.index[k]] -= x * row.value[k];
     }
   }
 
-  // solve L' u = v
+  // solve L u = v
   void solveLT(QpVector& rhs) {
     for (HighsInt i = rhs.dim - 1; i >= 0; i--) {
+      const SparseRow& row = L[i];
       double sum = 0.0;
-      for (HighsInt j = rhs.dim - 1; j > i; j--) {
-        sum += rhs.value[j] * L[i * current_k_max + j];
-      }
-      rhs.value[i] = (rhs.value[i] - sum) / L[i * current_k_max + i];
+      for (size_t k = 1; k < row.index.size(); k++)
+        sum += rhs.value[row.index[k]] * row.value[k];
+      rhs.value[i] = (rhs.value[i] - sum) / row.value[0];
     }
   }
 
@@ -213,66 +281,6 @@ class CholeskyFactor {
     rhs.resparsify();
   }
 
-  void eliminate(std::vector<double>& m, HighsInt i, HighsInt j, HighsInt kmax,
-                 HighsInt currentk) {
-    // i = col, j = row
-    if (m[j * kmax + i] == 0.0) {
-      return;
-    }
-    double z = sqrt(m[i * kmax + i] * m[i * kmax + i] +
-                    m[j * kmax + i] * m[j * kmax + i]);
-    double cos_, sin_;
-    if (z == 0) {
-      cos_ = 1.0;
-      sin_ = 0.0;
-    } else {
-      cos_ = m[i * kmax + i] / z;
-      sin_ = -m[j * kmax + i] / z;
-    }
-
-    if (sin_ == 0.0) {
-      if (cos_ > 0.0) {
-        // nothing
-      } else {
-        for (HighsInt k = 0; k < current_k; k++) {
-          // update entry i and j of column k
-          double a_ik = m[i * kmax + k];
-          // entry i
-          m[i * kmax + k] = -a_ik;
-          m[j * kmax + k] = -m[j * kmax + k];
-        }
-      }
-    } else if (cos_ == 0.0) {
-      if (sin_ > 0.0) {
-        for (HighsInt k = 0; k < current_k; k++) {
-          // update entry i and j of column k
-          double a_ik = m[i * kmax + k];
-          // entry i
-          m[i * kmax + k] = -m[j * kmax + k];
-          m[j * kmax + k] = a_ik;
-        }
-      } else {
-        for (HighsInt k = 0; k < current_k; k++) {
-          // update entry i and j of column k
-          double a_ik = m[i * kmax + k];
-          // entry i
-          m[i * kmax + k] = m[j * kmax + k];
-          m[j * kmax + k] = -a_ik;
-        }
-      }
-    } else {
-      // #pragma omp parallel for
-      for (HighsInt k = 0; k < current_k; k++) {
-        // update entry i and j of column k
-        double a_ik = m[i * kmax + k];
-        // entry i
-        m[i * kmax + k] = cos_ * a_ik - sin_ * m[j * kmax + k];
-        m[j * kmax + k] = sin_ * a_ik + cos_ * m[j * kmax + k];
-      }
-    }
-    m[j * kmax + i] = 0.0;
-  }
-
   void reduce(const QpVector& buffer_d, const HighsInt maxabsd, bool p_in_v) {
     if (current_k == 0) {
       return;
@@ -282,7 +290,7 @@ class CholeskyFactor {
     }
     numberofreduces++;
 
-    unsigned p = maxabsd;  // col we push to the right and remove
+    HighsInt p = maxabsd;  // col we push to the right and remove
 
     // start situation: p=3, current_k = 5
     // |1 x  | |x    |       |1   | |xxxxx|
@@ -292,38 +300,37 @@ class CholeskyFactor {
     //         |xxxxx|       |   1| |    x|
     // next step: move row/col p to the bottom/right
 
-    //> save row p
-    std::vector<double> row_p(current_k, 0.0);
-    for (HighsInt i = 0; i < current_k; i++) {
-      row_p[i] = L[p * current_k_max + i];
-    }
-
-    //> move all rows > p up by one row
-    for (HighsInt row = p; row < current_k - 1; row++) {
-      for (HighsInt i = 0; i < current_k; i++) {
-        L[row * current_k_max + i] = L[(row + 1) * current_k_max + i];
-      }
-    }
-
-    //> load row p
-    for (HighsInt i = 0; i < current_k; i++) {
-      L[(current_k - 1) * current_k_max + i] = row_p[i];
-    }
+    //> move row p to the bottom
+    std::rotate(L.begin() + p, L.begin() + p + 1, L.begin() + current_k);
 
-    //> now move col p to the right in each row
+    //> now move col p to the right in each row. Only the entries in columns
+    //> >= p change, and they keep their order except for the entry in
+    //> column p, which becomes the last entry.
+    std::vector<HighsInt> rows_with_p;
     for (HighsInt row = 0; row < current_k; row++) {
-      double p_entry = L[row * current_k_max + p];
-      for (HighsInt col = p; col < current_k - 1; col++) {
-        L[row * current_k_max + col] = L[row * current_k_max + col + 1];
-      }
-      L[row * current_k_max + current_k - 1] = p_entry;
+      SparseRow& r = L[row];
+      size_t start = std::lower_bound(r.index.begin(), r.index.end(), p) -
+                     r.index.begin();
+      if (start == r.index.size()) continue;
+      bool has_p = r.index[start] == p;
+      for (size_t k = start; k < r.index.size(); k++) r.index[k]--;
+      if (!has_p) continue;
+      r.index[start] = current_k - 1;
+      std::rotate(r.index.begin() + start, r.index.begin() + start + 1,
+                  r.index.end());
+      std::rotate(r.value.begin() + start, r.value.begin() + start + 1,
+                  r.value.end());
+      if (row < p) rows_with_p.push_back(row);
     }
 
     if (current_k == 1) {
-      current_k--;
+      removeLast();
       return;
     }
 
+    // the diagonal entry of the last row is now its last entry
+    SparseRow& lastrow = L[current_k - 1];
+
     if (!p_in_v) {
       // situation now:
       // |1   x| |x    |       |1   | |xxxxx|
@@ -332,8 +339,9 @@ class CholeskyFactor {
       // |   1x| |xxxxx|       |   1| |   x |
       //         |xx  x|       |xxxx| |  xxx|
       // next: remove nonzero entries in last column except for diagonal element
-      for (HighsInt r = (HighsInt)p - 1; r >= 0; r--) {  // to current_k-1
-        eliminate(L, current_k - 1, r, current_k_max, current_k);
+      for (auto it = rows_with_p.rbegin(); it != rows_with_p.rend(); ++it) {
+        eliminate(current_k - 1, *it, lastrow.value.back(),
+                  L[*it].value.back());
       }
 
       // situation now:
@@ -345,36 +353,61 @@ class CholeskyFactor {
       // next: multiply product
       // new last row: old last row (first current_k-1 elements) + r *
       // R_current_k_current_k
-
+      if ((HighsInt)work_value.size() < current_k) {
+        work_value.resize(current_k, 0.0);
+        work_mark.resize(current_k, false);
+      }
+      work_pattern.clear();
+      for (size_t k = 0; k < lastrow.index.size(); k++) {
+        work_value[lastrow.index[k]] = lastrow.value[k];
+        work_mark[lastrow.index[k]] = true;
+        work_pattern.push_back(lastrow.index[k]);
+      }
+      double lastdiag = lastrow.value.back();
       for (HighsInt i = 0; i < buffer_d.num_nz; i++) {
         HighsInt idx = buffer_d.index[i];
         if (idx == maxabsd) {
           continue;
         }
-        if (idx < maxabsd) {
-          L[(current_k - 1) * current_k_max + idx] +=
-              -buffer_d.value[idx] / buffer_d.value[maxabsd] *
-              L[(current_k - 1) * current_k_max + current_k - 1];
-        } else {
-          L[(current_k - 1) * current_k_max + idx - 1] +=
-              -buffer_d.value[idx] / buffer_d.value[maxabsd] *
-              L[(current_k - 1) * current_k_max + current_k - 1];
+        HighsInt col = idx < maxabsd ? idx : idx - 1;
+        if (!work_mark[col]) {
+          work_mark[col] = true;
+          work_pattern.push_back(col);
         }
+        work_value[col] +=
+            -buffer_d.value[idx] / buffer_d.value[maxabsd] * lastdiag;
+      }
+      std::sort(work_pattern.begin(), work_pattern.end());
+      lastrow.clear();
+      for (HighsInt col : work_pattern) {
+        if (work_value[col] != 0.0 || col == current_k - 1)
+          lastrow.push(col, work_value[col]);
+        work_value[col] = 0.0;
+        work_mark[col] = false;
       }
       // situation now: as above, but no more product
     }
-    // next: eliminate last row
-    for (HighsInt i = 0; i < current_k - 1; i++) {
-      eliminate(L, i, current_k - 1, current_k_max, current_k);
+
+    // next: eliminate last row. Rotating with row i only creates entries to
+    // the right of column i, so the first entry of the last row is the next
+    // one to eliminate
+    while (lastrow.index[0] != current_k - 1) {
+      HighsInt i = lastrow.index[0];
+      if (lastrow.value[0] == 0.0) {
+        lastrow.index.erase(lastrow.index.begin());
+        lastrow.value.erase(lastrow.value.begin());
+        continue;
+      }
+      eliminate(i, current_k - 1, L[i].value[0], lastrow.value[0]);
     }
-    current_k--;
+    removeLast();
   }
 
   void report(std::string name = "") {
     printf("%s\n", name.c_str());
     for (HighsInt i = 0; i < current_k; i++) {
       for (HighsInt j = 0; j < current_k; j++) {
-        printf("%lf ", L[i * current_k_max + j]);
+        printf("%lf ", entry(i, j));
       }
       printf("\n");
     }
@@ -387,8 +420,8 @@ class CholeskyFactor {
 
     HighsInt num_nz = 0;
     for (HighsInt i = 0; i < current_k; i++) {
-      for (HighsInt j = 0; j < current_k; j++) {
-        if (fabs(L[i * current_k_max + j]) > 1e-7) {
+      for (double value : L[i].value) {
+        if (fabs(value) > 1e-7) {
           num_nz++;
         }
       }
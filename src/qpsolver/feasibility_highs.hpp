@@ -5,6 +5,35 @@
 #include "qpsolver/a_asm.hpp"
 #include "qpsolver/crashsolution.hpp"
 
+// Whether each constraint that is active in the basis is at the
+// corresponding bound in the solution
+static bool isSolutionAtActiveBounds(const Instance& instance,
+				     const double tolerance,
+				     const HighsBasis& basis,
+				     const HighsSolution& solution) {
+  auto atActiveBound = [&](HighsBasisStatus status, double value,
+			   double lower, double upper) {
+    if (status == HighsBasisStatus::kLower)
+      return std::fabs(value - lower) <= tolerance;
+    if (status == HighsBasisStatus::kUpper)
+      return std::fabs(value - upper) <= tolerance;
+    return true;
+  };
+  for (HighsInt i = 0; i < instance.num_var; i++) {
+    // Free variables are inactive whatever their status
+    if (instance.var_lo[i] == -kHighsInf && instance.var_up[i] == kHighsInf)
+      continue;
+    if (!atActiveBound(basis.col_status[i], solution.col_value[i],
+		       instance.var_lo[i], instance.var_up[i]))
+      return false;
+  }
+  for (HighsInt i = 0; i < instance.num_con; i++)
+    if (!atActiveBound(basis.row_status[i], solution.row_value[i],
+		       instance.con_lo[i], instance.con_up[i]))
+      return false;
+  return true;
+}
+
 static void computeStartingPointHighs(Instance& instance,
 				      Settings& settings,
 				      Statistics& stats,
@@ -46,6 +75,12 @@ static void computeStartingPointHighs(Instance& instance,
       num_var_infeasibilities == 0 &&
       num_con_infeasibilities == 0 &&
       highs_basis.valid;
+    // After a change in bounds, a feasible solution may not be at the
+    // bounds of the constraints that are active in the basis
+    if (have_starting_point)
+      have_starting_point =
+	isSolutionAtActiveBounds(instance, primal_feasibility_tolerance,
+				 highs_basis, highs_solution);
   }
   // compute initial feasible point
   HighsBasis use_basis;
@@ -16,7 +16,7 @@ class Gradient {
       : runtime(rt), gradient(QpVector(rt.instance.num_var)), uptodate(false) {}
 
   void recompute() {
-    runtime.instance.Q.vec_mat(runtime.primal, gradient);
+    runtime.instance.Q.sym_mat_vec(runtime.primal, gradient);
     gradient += runtime.instance.c;
     uptodate = true;
     numupdates = 0;
@@ -1,9 +1,11 @@
 #ifndef __SRC_LIB_MATRIX_HPP__
 #define __SRC_LIB_MATRIX_HPP__
 
+#include <algorithm>
 #include <cassert>
 #include <vector>
 
+#include "parallel/HighsParallel.h"
 #include "qpvector.hpp"
 
 struct MatrixBase {
@@ -30,6 +32,39 @@ struct MatrixBase {
     return target;
   }
 
+  // For a symmetric matrix, column i is also row i, so entry i of the
+  // product is the inner product of column i with other. Unlike the
+  // scatter in mat_vec_seq, these are independent, so they are formed
+  // in parallel when other is too dense for the scatter to be cheaper
+  QpVector& sym_mat_vec(const QpVector& other, QpVector& target) const {
+    assert(num_row == num_col);
+    const double kDenseMatVecFraction = 0.1;
+    if (other.num_nz < kDenseMatVecFraction * num_col)
+      return mat_vec_seq(other, target);
+
+    // Form at least kMatVecGrainNz products of nonzeros in each task
+    const HighsInt kMatVecGrainNz = 8192;
+    const HighsInt num_nz = start[num_col];
+    const HighsInt grain_size = std::max(
+        HighsInt{1}, (HighsInt)((double)kMatVecGrainNz * num_col /
+                                std::max(num_nz, HighsInt{1})));
+    const double* x = other.value.data();
+    double* y = target.value.data();
+    highs::parallel::for_each(
+        0, num_col,
+        [&](HighsInt from_col, HighsInt to_col) {
+          for (HighsInt col = from_col; col < to_col; col++) {
+            double dot = 0.0;
+            for (HighsInt j = start[col]; j < start[col + 1]; j++)
+              dot += x[index[j]] * value[j];
+            y[col] = dot;
+          }
+        },
+        grain_size);
+    target.resparsify();
+    return target;
+  }
+
   QpVector mat_vec(const QpVector& other) {
     QpVector result(num_row);
     mat_vec(other, result);
@@ -294,6 +329,10 @@ struct Matrix {
     return mat.mat_vec(other, target);
   }
 
+  QpVector& sym_mat_vec(const QpVector& other, QpVector& target) const {
+    return mat.sym_mat_vec(other, target);
+  }
+
   QpVector mat_vec(const QpVector& other) { return mat.mat_vec(other); }
 
   QpVector vec_mat(const QpVector& other) const { return mat.vec_mat(other); }
@@ -3,6 +3,7 @@
 
 #include <util/HighsInt.h>
 
+#include <cassert>
 #include <cmath>
 #include <cstdio>
 #include <string>
@@ -121,7 +122,24 @@ struct QpVector {
     return *this;
   }
 
+  // Whether the index holds each nonzero of the vector exactly once, so
+  // that updates can work on the index rather than on all entries
+  bool indexOk() const {
+    if (num_nz < 0 || num_nz > dim) return false;
+    std::vector<bool> in_index(dim, false);
+    for (HighsInt i = 0; i < num_nz; i++) {
+      if (index[i] < 0 || index[i] >= dim || in_index[index[i]]) return false;
+      in_index[index[i]] = true;
+    }
+    for (HighsInt i = 0; i < dim; i++)
+      if (value[i] != 0.0 && !in_index[i]) return false;
+    return true;
+  }
+
   QpVector& saxpy(double a, const QpVector& x) {
+    // saxpy only looks at the entries in the index of each vector
+    assert(indexOk());
+    assert(x.indexOk());
     sanitize(0.0);
     for (HighsInt i = 0; i < x.num_nz; i++) {
       if (value[x.index[i]] == 0.0) {
@@ -129,8 +147,9 @@ struct QpVector {
       }
       value[x.index[i]] += a * x.value[x.index[i]];
     }
-    resparsify();
-    // sanitize(0.0);
+    // Only entries in the pattern of x can have become zero, so
+    // dropping them costs O(num_nz) rather than O(dim)
+    sanitize(0.0);
     return *this;
   }
 
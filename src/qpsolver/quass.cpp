@@ -93,22 +93,20 @@ static QpVector& computesearchdirection_major(Runtime& runtime, Basis& basis,
                                      CholeskyFactor& factor, const QpVector& yp,
                                      Gradient& gradient, QpVector& gyp, QpVector& l,
                                      QpVector& m, QpVector& p) {
-  QpVector yyp = yp; // TODO PERF: buffer QpVector
-  // if (gradient.getGradient().dot(yp) > 0.0) {
-  //   yyp.scale(-1.0);
-  // }
-  runtime.instance.Q.mat_vec(yyp, gyp);
+  runtime.instance.Q.sym_mat_vec(yp, gyp);
   if (basis.getnumactive() < runtime.instance.num_var) {
     basis.Ztprod(gyp, m);
     l = m;
     factor.solveL(l);
-    QpVector v = l; // TODO PERF: buffer QpVector
-    factor.solveLT(v);
-    basis.Zprod(v, p);
-    if (gradient.getGradient().dot(yyp) < 0.0) {
-      return p.saxpy(-1.0, 1.0, yyp);
+    // Z'Q*yp is not needed once l is known, so m is overwritten by the
+    // solution of the second triangular system
+    m = l;
+    factor.solveLT(m);
+    basis.Zprod(m, p);
+    if (gradient.getGradient().dot(yp) < 0.0) {
+      return p.saxpy(-1.0, 1.0, yp);
     } else {
-      return p.saxpy(-1.0, -1.0, yyp);
+      return p.saxpy(-1.0, -1.0, yp);
     }
 
   } else {
@@ -119,7 +117,7 @@ static QpVector& computesearchdirection_major(Runtime& runtime, Basis& basis,
 
 static double computemaxsteplength(Runtime& runtime, const QpVector& p,
                             Gradient& gradient, QpVector& buffer_Qp, bool& zcd) {
-  double denominator = p * runtime.instance.Q.mat_vec(p, buffer_Qp);
+  double denominator = p * runtime.instance.Q.sym_mat_vec(p, buffer_Qp);
   if (fabs(denominator) > runtime.settings.pQp_zero_threshold) {
     double numerator = -(p * gradient.getGradient());
     if (numerator < 0.0) {
@@ -416,7 +414,7 @@ void Quass::solve(const QpVector& x0, const QpVector& ra, Basis& b0, HighsTimer&
       computesearchdirection_minor(runtime, basis, factor, redgrad, p);
       computerowmove(runtime, basis, p, rowmove);
       tidyup(p, rowmove, basis, runtime);
-      runtime.instance.Q.mat_vec(p, buffer_Qp);
+      runtime.instance.Q.sym_mat_vec(p, buffer_Qp);
     }
     if (p.norm2() < runtime.settings.pnorm_zero_threshold ||
         maxsteplength == 0.0 || (false && fabs(gradient.getGradient().dot(p)) < runtime.settings.improvement_zero_threshold)) {
@@ -13,6 +13,8 @@
  */
 #include "simplex/HEkk.h"
 
+#include <algorithm>
+
 #include "lp_data/HighsLpSolverObject.h"
 #include "lp_data/HighsLpUtils.h"
 #include "lp_data/HighsModelUtils.h"
@@ -1275,6 +1277,83 @@ HighsStatus HEkk::setBasis(const HighsBasis& highs_basis) {
   return HighsStatus::kOk;
 }
 
+bool HEkk::setBasisKeepingInvert(const HighsLp& lp,
+                                 const HighsBasis& highs_basis) {
+  // If the HiGHS basis has the same basic variables as the simplex
+  // basis, then the invertible representation and the dual steepest
+  // edge weights remain valid, and only the nonbasic moves need to be
+  // set, as in setBasis. Their values are corrected with respect to
+  // the bounds when the next solve is initialised. The LP is passed
+  // since the incumbent LP is only moved to EKK for a solve
+  if (!status_.has_basis || !status_.has_invert) return false;
+  const HighsInt num_col = highs_basis.col_status.size();
+  const HighsInt num_row = highs_basis.row_status.size();
+  if (lp.num_col_ != num_col || lp.num_row_ != num_row) return false;
+  if ((HighsInt)basis_.nonbasicFlag_.size() != num_col + num_row) return false;
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    const bool basic = highs_basis.col_status[iCol] == HighsBasisStatus::kBasic;
+    if (basic != (basis_.nonbasicFlag_[iCol] == kNonbasicFlagFalse))
+      return false;
+  }
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    const bool basic = highs_basis.row_status[iRow] == HighsBasisStatus::kBasic;
+    if (basic != (basis_.nonbasicFlag_[num_col + iRow] == kNonbasicFlagFalse))
+      return false;
+  }
+
+  for (HighsInt iCol = 0; iCol < num_col; iCol++) {
+    if (highs_basis.col_status[iCol] == HighsBasisStatus::kBasic) continue;
+    if (lp.col_lower_[iCol] == lp.col_upper_[iCol]) {
+      basis_.nonbasicMove_[iCol] = kNonbasicMoveZe;
+      continue;
+    }
+    switch (highs_basis.col_status[iCol]) {
+      case HighsBasisStatus::kLower:
+        basis_.nonbasicMove_[iCol] = kNonbasicMoveUp;
+        break;
+      case HighsBasisStatus::kUpper:
+        basis_.nonbasicMove_[iCol] = kNonbasicMoveDn;
+        break;
+      default:
+        basis_.nonbasicMove_[iCol] = kNonbasicMoveZe;
+    }
+  }
+  for (HighsInt iRow = 0; iRow < num_row; iRow++) {
+    const HighsInt iVar = num_col + iRow;
+    if (highs_basis.row_status[iRow] == HighsBasisStatus::kBasic) continue;
+    if (lp.row_lower_[iRow] == lp.row_upper_[iRow]) {
+      basis_.nonbasicMove_[iVar] = kNonbasicMoveZe;
+      continue;
+    }
+    switch (highs_basis.row_status[iRow]) {
+      case HighsBasisStatus::kLower:
+        basis_.nonbasicMove_[iVar] = kNonbasicMoveDn;
+        break;
+      case HighsBasisStatus::kUpper:
+        basis_.nonbasicMove_[iVar] = kNonbasicMoveUp;
+        break;
+      default:
+        basis_.nonbasicMove_[iVar] = kNonbasicMoveZe;
+    }
+  }
+  basis_.debug_id = highs_basis.debug_id;
+  basis_.debug_update_count = highs_basis.debug_update_count;
+  basis_.debug_origin_name = highs_basis.debug_origin_name;
+  this->updateStatus(LpAction::kNewBounds);
+  // The hot start is for the basis of the most recent INVERT, which is
+  // unaffected, so it remains valid. If that basis has the current basic
+  // variables, the hot start takes the new nonbasic moves
+  if (hot_start_.valid) {
+    std::vector<HighsInt> hot_start_basic = hot_start_.refactor_info.pivot_var;
+    std::vector<HighsInt> basic = basis_.basicIndex_;
+    std::sort(hot_start_basic.begin(), hot_start_basic.end());
+    std::sort(basic.begin(), basic.end());
+    if (hot_start_basic == basic)
+      hot_start_.nonbasicMove = basis_.nonbasicMove_;
+  }
+  return true;
+}
+
 void HEkk::addCols(const HighsLp& lp,
                    const HighsSparseMatrix& scaled_a_matrix) {
   // Should be extendSimplexLpRandomVectors
@@ -2041,6 +2120,7 @@ HighsInt HEkk::computeFactor() {
   analysis_.simplexTimerStart(InvertClock);
   const HighsInt rank_deficiency = simplex_nla_.invert();
   analysis_.simplexTimerStop(InvertClock);
+  num_invert_++;
   //
   // Set up hot start information
   hot_start_.refactor_info = simplex_nla_.factor_.refactor_info_;
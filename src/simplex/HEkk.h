@@ -70,6 +70,8 @@ class HEkk {
   HighsStatus solve(const bool force_phase2 = false);
   HighsStatus setBasis();
   HighsStatus setBasis(const HighsBasis& highs_basis);
+  bool setBasisKeepingInvert(const HighsLp& lp,
+                             const HighsBasis& highs_basis);
 
   void freezeBasis(HighsInt& frozen_basis_id);
   HighsStatus unfreezeBasis(const HighsInt frozen_basis_id);
@@ -199,6 +201,8 @@ class HEkk {
 
   double build_synthetic_tick_ = 0;
   double total_synthetic_tick_ = 0;
+  // Number of INVERTs over the lifetime of the instance
+  int64_t num_invert_ = 0;
   HighsInt debug_solve_call_num_ = 0;
   HighsInt debug_basis_id_ = 0;
   bool time_report_ = false;
@@ -0,0 +1,100 @@
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/*                                                                       */
+/*    This file is part of the HiGHS linear optimization suite           */
+/*                                                                       */
+/*    Written and engineered 2008-2024 by Julian Hall, Ivet Galabova,    */
+/*    Leona Gottwald and Michael Feldmeier                               */
+/*                                                                       */
+/*    Available as open-source under the MIT License                     */
+/*                                                                       */
+/* * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * * */
+/**@file util/HighsNameTable.h
+ * @brief Map from names to integer values, for use when reading files
+ */
+#ifndef UTIL_HIGHS_NAME_TABLE_H_
+#define UTIL_HIGHS_NAME_TABLE_H_
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include "util/HighsHash.h"
+
+// Maps each name to an integer value. The characters of the names are
+// stored end to end in a single string, rather than as a string per
+// name. A HighsHashTable maps the hash of a name to the first entry
+// with that hash, and entries with the same hash are chained
+class HighsNameTable {
+ public:
+  // Returns a pointer to the value for a name, or nullptr if the name
+  // is not in the table
+  const int* find(const char* name, const size_t length) const {
+    return find(name, length, hash(name, length));
+  }
+
+  const int* find(const std::string& name) const {
+    return find(name.data(), name.size());
+  }
+
+  // Adds the name with the given value, returning false (and leaving
+  // the table unchanged) if the name is already in the table
+  bool insert(const std::string& name, const int value) {
+    const uint64_t name_hash = hash(name.data(), name.size());
+    if (find(name.data(), name.size(), name_hash) != nullptr) return false;
+    const HighsInt k = entry_.size();
+    Entry entry;
+    entry.start = chars_.size();
+    entry.length = name.size();
+    entry.value = value;
+    HighsInt* first = first_entry_.find(name_hash);
+    if (first == nullptr) {
+      entry.next = -1;
+      first_entry_.insert(name_hash, k);
+    } else {
+      entry.next = *first;
+      *first = k;
+    }
+    entry_.push_back(entry);
+    chars_.append(name);
+    return true;
+  }
+
+  HighsInt size() const { return entry_.size(); }
+
+  void clear() {
+    chars_.clear();
+    entry_.clear();
+    first_entry_.clear();
+  }
+
+ private:
+  struct Entry {
+    size_t start;
+    size_t length;
+    int value;
+    HighsInt next;
+  };
+
+  std::string chars_;
+  std::vector<Entry> entry_;
+  HighsHashTable<uint64_t, HighsInt> first_entry_;
+
+  static uint64_t hash(const char* name, const size_t length) {
+    return HighsHashHelpers::vector_hash(name, length);
+  }
+
+  const int* find(const char* name, const size_t length,
+                  const uint64_t name_hash) const {
+    const HighsInt* first = first_entry_.find(name_hash);
+    if (first == nullptr) return nullptr;
+    for (HighsInt k = *first; k >= 0; k = entry_[k].next) {
+      const Entry& entry = entry_[k];
+      if (entry.length == length &&
+          std::memcmp(&chars_[entry.start], name, length) == 0)
+        return &entry.value;
+    }
+    return nullptr;
+  }
+};
+
+#endif